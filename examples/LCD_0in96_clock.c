@@ -1,5 +1,7 @@
 #include "LCD_Test.h"
 #include "LCD_0in96.h"
+#include "GUI_Text.h"
+#include "GUI_Segment.h"
 #include "string.h"
 #include "pico/util/datetime.h"
 #include "ds3231.h"
@@ -9,6 +11,21 @@ extern char *week[];
 
 static UWORD *BlackImage = NULL;
 
+static PAINT_FONT_SET Clock_Fonts = {&Font12, NULL, NULL};
+static TEXT_RUN Clock_Runs[48];
+static TEXT_LAYOUT Clock_Layout;
+
+static const SEGMENT_FONT Clock_Digits = SEGMENT_FONT_INIT(18, 48, 5, 1);
+static SEGMENT_DISPLAY Clock_Time;
+static LCD_RECT Clock_Time_Rect;
+
+// Window commands and DMA blocks of an update: the date line goes as one
+// block, the time as a block per row
+static UDOUBLE Clock_Words[2 * LCD_WINDOW_WORDS];
+static LCD_STREAM Clock_Stream;
+static LCD_PIO_BLOCK Clock_Blocks[64];
+static LCD_PIO_CHAIN Clock_Chain;
+
 void lcd_clock_init(void) {
     DEV_Delay_ms(100);
     printf("Initializing LCD Clock...\r\n");
@@ -19,6 +36,12 @@ void lcd_clock_init(void) {
     }
 
     LCD_0IN96_Init(HORIZONTAL);
+    printf("LCD SPI clock %lu Hz\r\n", (unsigned long)LCD_0IN96_Calibrate());
+    if (!LCD_0IN96_UsePIO()) {
+        printf("LCD PIO transport unavailable, using SPI\r\n");
+    }
+    LCD_Stream_Init(&Clock_Stream, Clock_Words, sizeof(Clock_Words) / sizeof(Clock_Words[0]));
+    LCD_PIO_ChainInit(&Clock_Chain, Clock_Blocks, sizeof(Clock_Blocks) / sizeof(Clock_Blocks[0]));
     LCD_0IN96_Clear(WHITE);
 
     UDOUBLE Imagesize = LCD_0IN96_HEIGHT * LCD_0IN96_WIDTH * 2;
@@ -32,6 +55,16 @@ void lcd_clock_init(void) {
     Paint_SetScale(65);
     Paint_SetRotate(ROTATE_0);
     Paint_Clear(WHITE);
+    Text_NewLayout(&Clock_Layout, Clock_Runs, sizeof(Clock_Runs) / sizeof(Clock_Runs[0]));
+
+    // hh:mm:ss in large digits below the date line
+    UWORD time_width = Segment_Width(&Clock_Digits, "00:00:00", 4);
+    Segment_NewDisplay(&Clock_Time, &Clock_Digits, (LCD_0IN96.WIDTH - time_width) / 2,
+                       LCD_0IN96.HEIGHT - Clock_Digits.Height - 4, 4, BLACK, 0xE71C, WHITE);
+    Clock_Time_Rect.Xstart = (LCD_0IN96.WIDTH - time_width) / 2;
+    Clock_Time_Rect.Ystart = LCD_0IN96.HEIGHT - Clock_Digits.Height - 4;
+    Clock_Time_Rect.Xend = Clock_Time_Rect.Xstart + time_width;
+    Clock_Time_Rect.Yend = Clock_Time_Rect.Ystart + Clock_Digits.Height;
 
     DEV_SET_PWM(100);  // Max backlight
 }
@@ -50,23 +83,40 @@ void lcd_clock_update(void) {
         ds3231SetTime();
     }
 
-    char text[64] = " Datetime: ";
-    strcat(text, week[(unsigned char)buf[3] - 1]);
-
-    // Make a datetime string
-    char datetime_str[32];
-    snprintf(datetime_str, sizeof(datetime_str), "%02x/%02x/%02x %02x:%02x:%02x",
-             buf[6], buf[5], buf[4], buf[2], buf[1], buf[0]);
+    // Date line, laid out again only when the day changes
+    char text[32];
+    snprintf(text, sizeof(text), "%s %02x/%02x/%02x",
+             week[(unsigned char)buf[3] - 1], buf[6], buf[5], buf[4]);
+
+    // The last update may still be read from the image
+    LCD_PIO_Wait();
+
+    LCD_RECT rects[2];
+    UWORD count = 0;
+    if (Text_Layout(&Clock_Layout, text, &Clock_Fonts, LCD_0IN96.WIDTH, Font12.Height, TEXT_ALIGN_CENTER)) {
+        Text_Draw(&Clock_Layout, 0, 4, BLACK, WHITE);
+        rects[count].Xstart = 0;
+        rects[count].Ystart = 4;
+        rects[count].Xend = LCD_0IN96.WIDTH;
+        rects[count].Yend = 4 + Font12.Height;
+        count++;
+    }
 
-    int y_pos = (LCD_0IN96.HEIGHT - Font12.Height) / 2;
+    // Time, only the segments that toggled since the last second are drawn
+    char time_str[12];
+    snprintf(time_str, sizeof(time_str), "%02x:%02x:%02x", buf[2], buf[1], buf[0]);
+    if (Segment_Update(&Clock_Time, time_str) != 0) {
+        rects[count++] = Clock_Time_Rect;
+    }
 
-    Paint_Clear(WHITE);
-    Paint_DrawString_EN(10, y_pos, &text[0], &Font12, BLACK, WHITE);
-    Paint_DrawString_EN(20, y_pos + 12, &datetime_str[0], &Font12, BLACK, WHITE);
-    LCD_0IN96_Display(BlackImage);
+    if (count == 0) {
+        return;
+    }
+    LCD_0IN96_DisplayRects(&Clock_Stream, &Clock_Chain, rects, count, BlackImage);
 }
 
 void lcd_clock_deinit(void) {
+    LCD_PIO_Exit();
     if (BlackImage != NULL) {
         free(BlackImage);
         BlackImage = NULL;
@@ -33,6 +33,21 @@
 #define SPI_PORT spi1
 
 uint slice_num;
+static int spi_dma = -1;
+
+/**
+ * Backlight level and the fade the timer is running
+**/
+static volatile uint8_t pwm_level = 1;
+static volatile uint8_t pwm_target = 1;
+static struct repeating_timer pwm_timer;
+static volatile bool pwm_timer_on = false;
+
+/**
+ * Started tasks, and the alarm DEV_Task_Idle sleeps on
+**/
+static DEV_TASK *task_list = NULL;
+static volatile bool task_alarm_fired = false;
 /**
  * GPIO read and write
 **/
@@ -59,6 +74,90 @@ void DEV_SPI_Write_nByte(uint8_t pData[], uint32_t Len)
     spi_write_blocking(SPI_PORT, pData, Len);
 }
 
+/**
+ * Write 16-bit words, MSB first
+ * The SPI sends 16-bit frames for the call, so RGB565 pixels kept as
+ * native words go out high byte first without a byte swap. Runs of
+ * DEV_SPI_DMA_MIN words or more are fed by DMA.
+**/
+void DEV_SPI_Write_nWord(const uint16_t *pData, uint32_t Len)
+{
+    spi_set_format(SPI_PORT, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    if (Len < DEV_SPI_DMA_MIN || spi_dma < 0) {
+        spi_write16_blocking(SPI_PORT, pData, Len);
+    } else {
+        dma_channel_config c = dma_channel_get_default_config(spi_dma);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+        channel_config_set_read_increment(&c, true);
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_dreq(&c, spi_get_dreq(SPI_PORT, true));
+        dma_channel_configure(spi_dma, &c, &spi_get_hw(SPI_PORT)->dr, pData, Len, true);
+        dma_channel_wait_for_finish_blocking(spi_dma);
+        while (spi_is_busy(SPI_PORT))
+            tight_loop_contents();
+
+        // Nothing is read back, drop what came in and the overrun
+        while (spi_is_readable(SPI_PORT))
+            (void)spi_get_hw(SPI_PORT)->dr;
+        spi_get_hw(SPI_PORT)->icr = SPI_SSPICR_RORIC_BITS;
+    }
+    spi_set_format(SPI_PORT, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+}
+
+/**
+ * Change the SPI clock, returns the rate the divider gives
+**/
+UDOUBLE DEV_SPI_SetBaud(UDOUBLE Baud)
+{
+    return spi_set_baudrate(SPI_PORT, Baud);
+}
+
+/**
+ * Read a panel register back on the data line
+ * Reg   : Read command
+ * Dummy : Clocks the panel wants between command and data
+ * Only works where the panel SDA pin is bidirectional and wired to MOSI,
+ * elsewhere the pull-down reads zeros. Bit-banged at about 250 kHz.
+**/
+void DEV_SPI_Read(UBYTE Reg, UBYTE Dummy, UBYTE *pData, UBYTE Len)
+{
+    UBYTE i, Bit;
+
+    DEV_Digital_Write(LCD_DC_PIN, 0);
+    DEV_Digital_Write(LCD_CS_PIN, 0);
+    DEV_SPI_WriteByte(Reg);
+
+    gpio_set_function(LCD_CLK_PIN, GPIO_FUNC_SIO);
+    gpio_set_dir(LCD_CLK_PIN, GPIO_OUT);
+    gpio_put(LCD_CLK_PIN, 0);
+    gpio_set_function(LCD_MOSI_PIN, GPIO_FUNC_SIO);
+    gpio_set_dir(LCD_MOSI_PIN, GPIO_IN);
+    gpio_pull_down(LCD_MOSI_PIN);
+    DEV_Digital_Write(LCD_DC_PIN, 1);
+
+    for (i = 0; i < Dummy; i++) {
+        gpio_put(LCD_CLK_PIN, 1);
+        DEV_Delay_us(2);
+        gpio_put(LCD_CLK_PIN, 0);
+        DEV_Delay_us(2);
+    }
+    for (i = 0; i < Len; i++) {
+        pData[i] = 0;
+        for (Bit = 0; Bit < 8; Bit++) {
+            gpio_put(LCD_CLK_PIN, 1);
+            DEV_Delay_us(2);
+            pData[i] = (pData[i] << 1) | gpio_get(LCD_MOSI_PIN);
+            gpio_put(LCD_CLK_PIN, 0);
+            DEV_Delay_us(2);
+        }
+    }
+    DEV_Digital_Write(LCD_CS_PIN, 1);
+
+    gpio_disable_pulls(LCD_MOSI_PIN);
+    gpio_set_function(LCD_CLK_PIN, GPIO_FUNC_SPI);
+    gpio_set_function(LCD_MOSI_PIN, GPIO_FUNC_SPI);
+}
+
 
 
 /**
@@ -109,11 +208,12 @@ void DEV_KEY_Config(UWORD Pin)
 
 /**
  * delay x ms
+ * The core sleeps on a timer alarm instead of spinning. Drivers that can
+ * go on with other work during a wait use a DEV_TASK instead.
 **/
 void DEV_Delay_ms(UDOUBLE xms)
 {
-    uint32_t start = to_ms_since_boot(get_absolute_time());
-    while (to_ms_since_boot(get_absolute_time()) - start < xms);
+    sleep_ms(xms);
 }
 
 void DEV_Delay_us(UDOUBLE xus)
@@ -148,9 +248,11 @@ UBYTE DEV_Module_Init(void)
 {
  
     // SPI Config
-    spi_init(SPI_PORT, 10000 * 1000);
+    spi_init(SPI_PORT, DEV_SPI_BAUD);
     gpio_set_function(LCD_CLK_PIN, GPIO_FUNC_SPI);
     gpio_set_function(LCD_MOSI_PIN, GPIO_FUNC_SPI);
+    if (spi_dma < 0)
+        spi_dma = dma_claim_unused_channel(false);
     
     // GPIO Config
     DEV_GPIO_Init();
@@ -166,7 +268,7 @@ UBYTE DEV_Module_Init(void)
     
     
     //I2C Config
-    i2c_init(i2c1,300*1000);
+    i2c_init(i2c1,400*1000);    // Fast mode, the OLED controllers take it
     gpio_set_function(LCD_SDA_PIN,GPIO_FUNC_I2C);
     gpio_set_function(LCD_SCL_PIN,GPIO_FUNC_I2C);
     gpio_pull_up(LCD_SDA_PIN);
@@ -190,6 +292,11 @@ void DEV_SET_PWM(uint8_t Value){
     if(Value<0 || Value >100){
         printf("DEV_SET_PWM Error \r\n");
     }else {
+        if (pwm_timer_on) {
+            cancel_repeating_timer(&pwm_timer);
+            pwm_timer_on = false;
+        }
+        pwm_level = pwm_target = Value;
         pwm_set_chan_level(slice_num, PWM_CHAN_B, Value);
     }
         
@@ -197,6 +304,183 @@ void DEV_SET_PWM(uint8_t Value){
     
 }
 
+/**
+ * One backlight step from the fade timer
+**/
+static bool DEV_PWM_Step(struct repeating_timer *t)
+{
+    if (pwm_level < pwm_target)
+        pwm_level++;
+    else if (pwm_level > pwm_target)
+        pwm_level--;
+    pwm_set_chan_level(slice_num, PWM_CHAN_B, pwm_level);
+    if (pwm_level == pwm_target) {
+        pwm_timer_on = false;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Fade the backlight to Value (0~100) over about Time_ms
+ * One level per timer tick, the CPU is free while it runs. A new fade or
+ * DEV_SET_PWM replaces the one in progress.
+**/
+void DEV_PWM_Fade(uint8_t Value, uint32_t Time_ms)
+{
+    uint8_t Steps;
+    int32_t Period;
+
+    if (Value > 100) {
+        printf("DEV_PWM_Fade Error \r\n");
+        return;
+    }
+    Steps = (Value > pwm_level) ? Value - pwm_level : pwm_level - Value;
+    if (Steps == 0 || Time_ms < Steps) {
+        DEV_SET_PWM(Value);
+        return;
+    }
+    if (pwm_timer_on) {
+        cancel_repeating_timer(&pwm_timer);
+        pwm_timer_on = false;
+    }
+    pwm_target = Value;
+    Period = Time_ms / Steps;
+    pwm_timer_on = add_repeating_timer_ms(-Period, DEV_PWM_Step, NULL, &pwm_timer);
+    if (!pwm_timer_on)
+        DEV_SET_PWM(Value);
+}
+
+/**
+ * Backlight level now, and whether a fade is still running
+**/
+uint8_t DEV_PWM_Level(void)
+{
+    return pwm_level;
+}
+
+bool DEV_PWM_Fading(void)
+{
+    return pwm_timer_on;
+}
+
+/**
+ * Start a task, its first step runs at the next DEV_Task_Service
+ * Task is kept by the service until its step returns DEV_TASK_DONE or it
+ * is cancelled.
+**/
+void DEV_Task_Start(DEV_TASK *Task, DEV_TASK_STEP Step, void *User)
+{
+    if (DEV_Task_Busy(Task)) {
+        printf("DEV_Task_Start Task already started \r\n");
+        return;
+    }
+    Task->Step = Step;
+    Task->User = User;
+    Task->Resume = get_absolute_time();
+    Task->Next = task_list;
+    task_list = Task;
+}
+
+/**
+ * Drop a task before it finishes, no further step runs
+ * Not to be called from a step.
+**/
+void DEV_Task_Cancel(DEV_TASK *Task)
+{
+    DEV_TASK **pLink;
+
+    for (pLink = &task_list; *pLink != NULL; pLink = &(*pLink)->Next) {
+        if (*pLink == Task) {
+            *pLink = Task->Next;
+            return;
+        }
+    }
+}
+
+bool DEV_Task_Busy(DEV_TASK *Task)
+{
+    DEV_TASK *pTask;
+
+    for (pTask = task_list; pTask != NULL; pTask = pTask->Next)
+        if (pTask == Task)
+            return true;
+    return false;
+}
+
+/**
+ * Run the step of every task that is due
+ * Call it from the main loop. Steps may start other tasks, which run from
+ * the next call. Returns the number of tasks still started.
+**/
+UBYTE DEV_Task_Service(void)
+{
+    DEV_TASK **pLink = &task_list;
+    DEV_TASK *Task;
+    UDOUBLE Wait;
+    UBYTE Count = 0;
+    uint64_t Now = to_us_since_boot(get_absolute_time());
+
+    while ((Task = *pLink) != NULL) {
+        if (to_us_since_boot(Task->Resume) > Now) {
+            pLink = &Task->Next;
+            Count++;
+            continue;
+        }
+        Wait = Task->Step(Task);
+        if (Wait == DEV_TASK_DONE) {
+            // tasks started by the step went in front of it
+            for (pLink = &task_list; *pLink != Task; pLink = &(*pLink)->Next)
+                ;
+            *pLink = Task->Next;
+            continue;
+        }
+        Task->Resume = make_timeout_time_ms(Wait);
+        pLink = &Task->Next;
+        Count++;
+    }
+    return Count;
+}
+
+static int64_t DEV_Task_Alarm(alarm_id_t id, void *user_data)
+{
+    task_alarm_fired = true;
+    return 0;
+}
+
+/**
+ * Sleep (WFI) until the next task is due or any interrupt comes in
+ * Call it when the main loop has nothing else to do. With no task started
+ * only an interrupt wakes the core.
+**/
+void DEV_Task_Idle(void)
+{
+    DEV_TASK *pTask;
+    alarm_id_t Alarm = 0;
+    uint64_t Next = UINT64_MAX;
+    uint32_t Save;
+
+    for (pTask = task_list; pTask != NULL; pTask = pTask->Next)
+        if (to_us_since_boot(pTask->Resume) < Next)
+            Next = to_us_since_boot(pTask->Resume);
+
+    task_alarm_fired = false;
+    if (Next != UINT64_MAX) {
+        Alarm = add_alarm_at(from_us_since_boot(Next), DEV_Task_Alarm, NULL, false);
+        if (Alarm <= 0)
+            return; // due already, or no alarm free
+    }
+
+    // an interrupt pending while masked still ends the WFI
+    Save = save_and_disable_interrupts();
+    if (!task_alarm_fired)
+        __wfi();
+    restore_interrupts(Save);
+
+    if (Alarm > 0)
+        cancel_alarm(Alarm);
+}
+
 /******************************************************************************
 function:	Module exits, closes SPI and BCM2835 library
 parameter:
@@ -34,6 +34,8 @@
 #include "stdio.h"
 #include "hardware/i2c.h"
 #include "hardware/pwm.h"
+#include "hardware/dma.h"
+#include "hardware/sync.h"
 
 /**
  * data
@@ -42,6 +44,41 @@
 #define UWORD   uint16_t
 #define UDOUBLE uint32_t
 
+/**
+ * SPI clock set by DEV_Module_Init
+**/
+#define DEV_SPI_BAUD (10000 * 1000)
+
+/**
+ * Shortest DEV_SPI_Write_nWord run sent by DMA, shorter ones are copied
+ * into the FIFO by the CPU
+**/
+#define DEV_SPI_DMA_MIN 32
+
+/**
+ * Task step result when the task has finished
+**/
+#define DEV_TASK_DONE 0xFFFFFFFF
+
+typedef struct DEV_TASK DEV_TASK;
+
+/**
+ * One step of a task, returns the ms to wait before the next step or
+ * DEV_TASK_DONE
+**/
+typedef UDOUBLE (*DEV_TASK_STEP)(DEV_TASK *Task);
+
+/**
+ * Work split into steps with waits between them, e.g. a panel reset and
+ * init sequence, run by DEV_Task_Service
+**/
+struct DEV_TASK {
+    DEV_TASK_STEP Step;
+    void *User;                 // for Step, usually the driver
+    absolute_time_t Resume;     // when the next step is due
+    DEV_TASK *Next;             // started tasks
+};
+
 /**
  * GPIOI config
 **/
@@ -67,16 +104,28 @@ UBYTE DEV_Digital_Read(UWORD Pin);
 
 void DEV_SPI_WriteByte(UBYTE Value);
 void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len);
+void DEV_SPI_Write_nWord(const uint16_t *pData, uint32_t Len);
+UDOUBLE DEV_SPI_SetBaud(UDOUBLE Baud);
+void DEV_SPI_Read(UBYTE Reg, UBYTE Dummy, UBYTE *pData, UBYTE Len);
 
 void DEV_Delay_ms(UDOUBLE xms);
 void DEV_Delay_us(UDOUBLE xus);
 
+void DEV_Task_Start(DEV_TASK *Task, DEV_TASK_STEP Step, void *User);
+void DEV_Task_Cancel(DEV_TASK *Task);
+bool DEV_Task_Busy(DEV_TASK *Task);
+UBYTE DEV_Task_Service(void);
+void DEV_Task_Idle(void);
+
 
 void DEV_I2C_Write(uint8_t addr, uint8_t reg, uint8_t Value);
 void DEV_I2C_Write_nByte(uint8_t addr, uint8_t *pData, uint32_t Len);
 uint8_t DEV_I2C_ReadByte(uint8_t addr, uint8_t reg);
 
 void DEV_SET_PWM(uint8_t Value);
+void DEV_PWM_Fade(uint8_t Value, uint32_t Time_ms);
+uint8_t DEV_PWM_Level(void);
+bool DEV_PWM_Fading(void);
 
 UBYTE DEV_Module_Init(void);
 void DEV_Module_Exit(void);
@@ -37,6 +37,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
+#include "font12CN_index.h"
 
 
 // 
@@ -147,6 +148,10 @@ cFONT Font12CN = {
   11, /* ASCII Width */
   16, /* Width */
   21, /* Height */
+  Font12CN_Index,
+  sizeof(Font12CN_Index)/sizeof(CH_CN_INDEX),  /*size of index*/
+  Font12CN_UIndex,
+  sizeof(Font12CN_UIndex)/sizeof(CH_CN_INDEX),  /*size of Unicode index*/
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -37,6 +37,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
+#include "font24CN_index.h"
 
 
 // 
@@ -519,6 +520,10 @@ cFONT Font24CN = {
   24, /* ASCII Width */
   32, /* Width */
   41, /* Height */
+  Font24CN_Index,
+  sizeof(Font24CN_Index)/sizeof(CH_CN_INDEX),  /*size of index*/
+  Font24CN_UIndex,
+  sizeof(Font24CN_UIndex)/sizeof(CH_CN_INDEX),  /*size of Unicode index*/
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -69,6 +69,13 @@ typedef struct                                          // 
 }CH_CN;
 
 
+//Sorted glyph index, generated from the table by tools/font_index.py
+typedef struct
+{
+  uint16_t code;                                      // index[0] << 8 | index[1]
+  uint16_t glyph;                                     // position in the table
+}CH_CN_INDEX;
+
 typedef struct
 {    
   const CH_CN *table;
@@ -76,15 +83,79 @@ typedef struct
   uint16_t ASCII_Width;
   uint16_t Width;
   uint16_t Height;
+  const CH_CN_INDEX *index;                           // NULL to scan the table
+  uint16_t index_size;
+  const CH_CN_INDEX *uindex;                          // by Unicode code point
+  uint16_t uindex_size;
   
 }cFONT;
 
+//Proportional glyphs up to 0xFF, generated by tools/fontc.py
+typedef struct
+{
+  uint16_t offset;                                    // first byte in bitmap
+  uint8_t  Width;                                     // bounding box
+  uint8_t  Height;
+  uint8_t  advance;                                   // pen step to the next glyph
+  int8_t   x_offset;                                  // box left, from the pen
+  int8_t   y_offset;                                  // box top, from the line top
+}pGLYPH;
+
+typedef struct
+{
+  uint8_t  left;
+  uint8_t  right;
+  int8_t   adjust;                                    // added to the advance of left
+}pKERN;
+
+typedef struct
+{
+  const uint8_t *bitmap;                              // rows packed with no padding
+  const pGLYPH *glyph;                                // first .. last
+  const pKERN *kern;                                  // sorted by left then right
+  uint16_t kern_size;
+  uint8_t  first;
+  uint8_t  last;
+  uint16_t Height;                                    // line height
+
+}pFONT;
+
+//Run-length coded cell glyphs up to 0xFF, generated by tools/fontc.py.
+//Each row of the box is a list of run bytes: bits 6-4 background, bits
+//3-0 foreground, and bit 7 set on the last byte of the row, after which
+//the row is background.
+typedef struct
+{
+  uint16_t offset;                                    // first byte in runs
+  uint8_t  Width;                                     // bounding box
+  uint8_t  Height;
+  int8_t   x_offset;                                  // box left, from the cell left
+  int8_t   y_offset;                                  // box top, from the cell top
+}rGLYPH;
+
+typedef struct
+{
+  const uint8_t *runs;
+  const rGLYPH *glyph;                                // first .. last
+  uint8_t  first;
+  uint8_t  last;
+  uint16_t Width;                                     // cell, the pen step
+  uint16_t Height;
+
+}rFONT;
+
 extern sFONT Font24;
 extern sFONT Font20;
 extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+extern pFONT Font24P;
+extern pFONT Font16P;
+
+extern rFONT Font24R;
+extern rFONT Font20R;
+
 extern cFONT Font12CN;
 extern cFONT Font24CN;
 #ifdef __cplusplus
@@ -0,0 +1,225 @@
+/*****************************************************************************
+* | File      	:   GUI_Dither.c
+* | Function    :   RGB565 to 1/2/4 bit per pixel conversion
+* | Info        :
+*                Output pixels are packed most significant bits first, rows
+*                are DITHER_ROW_BYTES long. 0 is black and the highest level
+*                is white, which matches Paint_SetPixel at Scale 2.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Dither.h"
+#include "Debug.h"
+#include <string.h> //memset()
+
+/**
+ * 4x4 Bayer matrix scaled to thresholds in 0..255
+**/
+static const UBYTE Dither_Bayer4[4][4] = {
+    {  8, 136,  40, 168},
+    {200,  72, 232, 104},
+    { 56, 184,  24, 152},
+    {248, 120, 216,  88},
+};
+
+static UBYTE Dither_Bpp(UBYTE Scale)
+{
+    if (Scale == 2)
+        return 1;
+    if (Scale == 4)
+        return 2;
+    if (Scale == 16)
+        return 4;
+    return 0;
+}
+
+/******************************************************************************
+function: RGB565 to 8 bit luma (Rec.601 weights)
+******************************************************************************/
+static inline UWORD Dither_Luma(UWORD Color)
+{
+    return ((Color >> 11) * 630 + ((Color >> 5) & 0x3f) * 608 + (Color & 0x1f) * 240 + 128) >> 8;
+}
+
+/******************************************************************************
+function: Store a full 32 bit accumulator, most significant byte first
+******************************************************************************/
+static inline UBYTE *Dither_StoreWord(UBYTE *pDst, uint32_t Acc)
+{
+    pDst[0] = Acc >> 24;
+    pDst[1] = Acc >> 16;
+    pDst[2] = Acc >> 8;
+    pDst[3] = Acc;
+    return pDst + 4;
+}
+
+/******************************************************************************
+function: Store the bits left in the accumulator at the end of a row
+******************************************************************************/
+static inline void Dither_StoreTail(UBYTE *pDst, uint32_t Acc, UBYTE Bits)
+{
+    Acc <<= 32 - Bits;
+    for (; Bits > 0; Bits = (Bits > 8) ? Bits - 8 : 0)
+    {
+        *pDst++ = Acc >> 24;
+        Acc <<= 8;
+    }
+}
+
+/******************************************************************************
+function: Ordered (Bayer 4x4) dither of one row
+parameter:
+    Src    : RGB565 source, Width pixels
+    Order  : Byte order of the source
+    Width  : Width in pixels
+    Y      : Row number in the image, picks the threshold row
+    Dst    : Destination, DITHER_ROW_BYTES(Width, Scale) bytes
+    Scale  : 2, 4 or 16 levels
+info:
+    Pixels are packed into a 32 bit accumulator and written a word at a time.
+    Rows can be done in any order and give the same result as the whole image.
+******************************************************************************/
+void Dither_OrderedRow(const UBYTE *Src, DITHER_SRC_ORDER Order, UWORD Width, UWORD Y,
+                       UBYTE *Dst, UBYTE Scale)
+{
+    UBYTE Bpp = Dither_Bpp(Scale);
+    if (Bpp == 0)
+    {
+        Debug("Dither Scale Only support: 2 4 16\r\n");
+        return;
+    }
+
+    UWORD Levels = (1 << Bpp) - 1;
+    UBYTE Hi = (Order == DITHER_SRC_LE) ? 1 : 0;
+    UBYTE Lo = 1 - Hi;
+    const UBYTE *Thr = Dither_Bayer4[Y & 3];
+    uint32_t Acc = 0;
+    UBYTE Bits = 0;
+    UWORD X, Luma;
+
+    for (X = 0; X < Width; X++)
+    {
+        Luma = Dither_Luma(Src[Hi] << 8 | Src[Lo]);
+        Luma += Luma >> 7; // 0..256, so that white never rounds down
+        Src += 2;
+
+        Acc = (Acc << Bpp) | ((Luma * Levels + Thr[X & 3]) >> 8);
+        Bits += Bpp;
+        if (Bits == 32)
+        {
+            Dst = Dither_StoreWord(Dst, Acc);
+            Acc = 0;
+            Bits = 0;
+        }
+    }
+    if (Bits)
+        Dither_StoreTail(Dst, Acc, Bits);
+}
+
+/******************************************************************************
+function: Ordered (Bayer 4x4) dither
+parameter:
+    Src    : RGB565 source, Width * Height pixels
+    Order  : Byte order of the source
+    Width  : Width in pixels
+    Height : Height in pixels
+    Dst    : Destination, DITHER_ROW_BYTES(Width, Scale) * Height bytes
+    Scale  : 2, 4 or 16 levels
+******************************************************************************/
+void Dither_Ordered(const UBYTE *Src, DITHER_SRC_ORDER Order, UWORD Width, UWORD Height,
+                    UBYTE *Dst, UBYTE Scale)
+{
+    UWORD Row_Bytes = DITHER_ROW_BYTES(Width, Scale);
+    UWORD Y;
+
+    if (Dither_Bpp(Scale) == 0)
+    {
+        Debug("Dither Scale Only support: 2 4 16\r\n");
+        return;
+    }
+
+    for (Y = 0; Y < Height; Y++)
+        Dither_OrderedRow(Src + (UDOUBLE)Y * Width * 2, Order, Width, Y, Dst + (UDOUBLE)Y * Row_Bytes, Scale);
+}
+
+/******************************************************************************
+function: Floyd-Steinberg error diffusion
+parameter:
+    Src     : RGB565 source, Width * Height pixels
+    Order   : Byte order of the source
+    Width   : Width in pixels
+    Height  : Height in pixels
+    Dst     : Destination, DITHER_ROW_BYTES(Width, Scale) * Height bytes
+    Scale   : 2, 4 or 16 levels
+    Err_Row : Scratch of DITHER_ERR_ROW_LEN(Width) entries
+info:
+    Errors are kept in 1/16 luma steps. Err_Row holds the error for the next
+    row; the three values still needed for it are carried in locals, so one
+    row of scratch is enough.
+******************************************************************************/
+void Dither_ErrorDiffusion(const UBYTE *Src, DITHER_SRC_ORDER Order, UWORD Width, UWORD Height,
+                           UBYTE *Dst, UBYTE Scale, int16_t *Err_Row)
+{
+    UBYTE Bpp = Dither_Bpp(Scale);
+    if (Bpp == 0)
+    {
+        Debug("Dither Scale Only support: 2 4 16\r\n");
+        return;
+    }
+
+    UWORD Levels = (1 << Bpp) - 1;
+    UWORD Row_Bytes = DITHER_ROW_BYTES(Width, Scale);
+    UBYTE Hi = (Order == DITHER_SRC_LE) ? 1 : 0;
+    UBYTE Lo = 1 - Hi;
+    int16_t *Err = Err_Row + 1; // Err[-1] and Err[Width] are guards
+    int16_t Level_Value[16];
+    UWORD X, Y, Q;
+
+    for (Q = 0; Q <= Levels; Q++)
+        Level_Value[Q] = Q * 255 * 16 / Levels;
+    memset(Err_Row, 0, DITHER_ERR_ROW_LEN(Width) * sizeof(int16_t));
+
+    for (Y = 0; Y < Height; Y++)
+    {
+        const UBYTE *pSrc = Src + (UDOUBLE)Y * Width * 2;
+        UBYTE *pDst = Dst + (UDOUBLE)Y * Row_Bytes;
+        uint32_t Acc = 0;
+        UBYTE Bits = 0;
+        int Right = 0, Below_Left = 0, Below = 0;
+
+        for (X = 0; X < Width; X++)
+        {
+            int Cur = Dither_Luma(pSrc[Hi] << 8 | pSrc[Lo]) * 16 + Err[X] + Right;
+            pSrc += 2;
+            if (Cur < 0)
+                Cur = 0;
+            else if (Cur > 255 * 16)
+                Cur = 255 * 16;
+
+            Q = (((Cur + 8) >> 4) * Levels + 127) / 255;
+            int E = Cur - Level_Value[Q];
+
+            // 7/16 right, 3/16 below left, 5/16 below, 1/16 below right
+            Right = (E * 7) >> 4;
+            Err[X - 1] = Below_Left + ((E * 3) >> 4);
+            Below_Left = Below + ((E * 5) >> 4);
+            Below = E >> 4;
+
+            Acc = (Acc << Bpp) | Q;
+            Bits += Bpp;
+            if (Bits == 32)
+            {
+                pDst = Dither_StoreWord(pDst, Acc);
+                Acc = 0;
+                Bits = 0;
+            }
+        }
+        Err[Width - 1] = Below_Left;
+        Err[Width] = 0;
+        if (Bits)
+            Dither_StoreTail(pDst, Acc, Bits);
+    }
+}
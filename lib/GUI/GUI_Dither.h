@@ -0,0 +1,45 @@
+/*****************************************************************************
+* | File      	:   GUI_Dither.h
+* | Function    :   RGB565 to 1/2/4 bit per pixel conversion
+* | Info        :
+*                Turns RGB565 images and Paint framebuffers into the row-major
+*                layout used by Paint at Scale 2, 4 and 16, so colour assets
+*                can be shown on the monochrome OLED panels.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_DITHER_H
+#define __GUI_DITHER_H
+
+#include "DEV_Config.h"
+
+/**
+ * Byte order of the RGB565 source
+**/
+typedef enum {
+    DITHER_SRC_LE = 0,  // low byte first, as ImageData.c and a Paint Scale 65 image
+    DITHER_SRC_BE,      // high byte first, as sent to the panel
+} DITHER_SRC_ORDER;
+
+/**
+ * Destination row size in bytes for a width and Scale (2, 4 or 16)
+**/
+#define DITHER_ROW_BYTES(Width, Scale) \
+    (((Width) * ((Scale) == 2 ? 1 : (Scale) == 4 ? 2 : 4) + 7) / 8)
+
+/**
+ * Error buffer length needed by Dither_ErrorDiffusion
+**/
+#define DITHER_ERR_ROW_LEN(Width) ((Width) + 2)
+
+void Dither_OrderedRow(const UBYTE *Src, DITHER_SRC_ORDER Order, UWORD Width, UWORD Y,
+                       UBYTE *Dst, UBYTE Scale);
+void Dither_Ordered(const UBYTE *Src, DITHER_SRC_ORDER Order, UWORD Width, UWORD Height,
+                    UBYTE *Dst, UBYTE Scale);
+void Dither_ErrorDiffusion(const UBYTE *Src, DITHER_SRC_ORDER Order, UWORD Width, UWORD Height,
+                           UBYTE *Dst, UBYTE Scale, int16_t *Err_Row);
+
+#endif
@@ -80,26 +80,36 @@ void Paint_SetScale(UBYTE scale)
     {
         Paint.Scale = scale;
         Paint.WidthByte = (Paint.WidthMemory % 8 == 0) ? (Paint.WidthMemory / 8) : (Paint.WidthMemory / 8 + 1);
+        Paint.HeightByte = Paint.HeightMemory;
     }
     else if (scale == 4)
     {
         Paint.Scale = scale;
         Paint.WidthByte = (Paint.WidthMemory % 4 == 0) ? (Paint.WidthMemory / 4) : (Paint.WidthMemory / 4 + 1);
+        Paint.HeightByte = Paint.HeightMemory;
     }
     else if (scale == 16)
     {
         Paint.Scale = scale;
         Paint.WidthByte = (Paint.WidthMemory % 2 == 0) ? (Paint.WidthMemory / 2) : (Paint.WidthMemory / 2 + 1);
+        Paint.HeightByte = Paint.HeightMemory;
     }
     else if (scale == 65)
     {
         Paint.Scale = scale;
         Paint.WidthByte = Paint.WidthMemory * 2;
+        Paint.HeightByte = Paint.HeightMemory;
+    }
+    else if (scale == PAINT_SCALE_PAGE)
+    {
+        Paint.Scale = scale;
+        Paint.WidthByte = Paint.WidthMemory;
+        Paint.HeightByte = (Paint.HeightMemory + 7) / 8; // pages
     }
     else
     {
         Debug("Set Scale Input parameter error\r\n");
-        Debug("Scale Only support: 2 4 16 65\r\n");
+        Debug("Scale Only support: 2 4 16 65 PAINT_SCALE_PAGE\r\n");
     }
 }
 /******************************************************************************
@@ -213,8 +223,124 @@ void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
     else if (Paint.Scale == 65)
     {
         UDOUBLE Addr = X * 2 + Y * Paint.WidthByte;
-        Paint.Image[Addr] = 0xff & (Color >> 8);
-        Paint.Image[Addr + 1] = 0xff & Color;
+        *(UWORD *)(Paint.Image + Addr) = Color;
+    }
+    else if (Paint.Scale == PAINT_SCALE_PAGE)
+    {
+        UDOUBLE Addr = X + (Y / 8) * Paint.WidthByte;
+        if ((Color & 0xff) == BLACK)
+            Paint.Image[Addr] &= ~(1 << (Y % 8));
+        else
+            Paint.Image[Addr] |= 1 << (Y % 8);
+    }
+}
+
+/******************************************************************************
+function: Draw a horizontal run of pixels
+parameter:
+    Xpoint : Starting X coordinate
+    Ypoint : Y coordinate
+    Len    : Number of pixels in the run
+    Color  : Painted colors
+info:
+    The run is clipped to the image. An RGB565 image that is neither rotated
+    nor mirrored is written directly, as is a page image that is not
+    rotated or mirrored left to right. Everything else goes through
+    Paint_SetPixel.
+******************************************************************************/
+void Paint_DrawSpan(UWORD Xpoint, UWORD Ypoint, UWORD Len, UWORD Color)
+{
+    if (Xpoint >= Paint.Width || Ypoint >= Paint.Height)
+    {
+        Debug("Paint_DrawSpan Input exceeds the normal display range\r\n");
+        return;
+    }
+    if (Len > Paint.Width - Xpoint)
+        Len = Paint.Width - Xpoint;
+
+    if (Paint.Scale == 65 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE)
+    {
+        UWORD *pDst = (UWORD *)(Paint.Image + Xpoint * 2 + Ypoint * Paint.WidthByte);
+        while (Len--)
+        {
+            *pDst++ = Color;
+        }
+        return;
+    }
+    if (Paint.Scale == PAINT_SCALE_PAGE && Paint.Rotate == ROTATE_0 && !(Paint.Mirror & MIRROR_HORIZONTAL))
+    {
+        UWORD Y = (Paint.Mirror & MIRROR_VERTICAL) ? Paint.HeightMemory - Ypoint - 1 : Ypoint;
+        UBYTE *pDst = Paint.Image + Xpoint + (Y / 8) * Paint.WidthByte;
+        UBYTE Bit = 1 << (Y % 8);
+        if ((Color & 0xff) == BLACK)
+        {
+            while (Len--)
+                *pDst++ &= ~Bit;
+        }
+        else
+        {
+            while (Len--)
+                *pDst++ |= Bit;
+        }
+        return;
+    }
+
+    while (Len--)
+    {
+        Paint_SetPixel(Xpoint++, Ypoint, Color);
+    }
+}
+
+/******************************************************************************
+function: Draw a horizontal run of pixels, dropping what is off the image
+parameter:
+    Xpoint : Starting X coordinate, may be negative
+    Ypoint : Y coordinate, may be off the image
+    Len    : Number of pixels in the run
+    Color  : Painted colors
+******************************************************************************/
+static void Paint_DrawSpanClipped(int32_t Xpoint, int32_t Ypoint, int32_t Len, UWORD Color)
+{
+    if (Ypoint < 0 || Ypoint >= Paint.Height)
+        return;
+    if (Xpoint < 0)
+    {
+        Len += Xpoint;
+        Xpoint = 0;
+    }
+    if (Len > (int32_t)Paint.Width - Xpoint)
+        Len = (int32_t)Paint.Width - Xpoint;
+    if (Len > 0)
+        Paint_DrawSpan(Xpoint, Ypoint, Len, Color);
+}
+
+/******************************************************************************
+function: Draw a horizontal run of pixels, one color per pixel
+parameter:
+    Xpoint : Starting X coordinate
+    Ypoint : Y coordinate
+    Len    : Number of pixels in the run
+    Colors : Len colors
+******************************************************************************/
+void Paint_DrawRow(UWORD Xpoint, UWORD Ypoint, UWORD Len, const UWORD *Colors)
+{
+    if (Xpoint >= Paint.Width || Ypoint >= Paint.Height)
+    {
+        Debug("Paint_DrawRow Input exceeds the normal display range\r\n");
+        return;
+    }
+    if (Len > Paint.Width - Xpoint)
+        Len = Paint.Width - Xpoint;
+
+    if (Paint.Scale == 65 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE)
+    {
+        memcpy(Paint.Image + Xpoint * 2 + Ypoint * Paint.WidthByte, Colors, Len * 2);
+        return;
+    }
+
+    while (Len--)
+    {
+        Paint_SetPixel(Xpoint++, Ypoint, *Colors++);
     }
 }
 
@@ -250,16 +376,17 @@ void Paint_Clear(UWORD Color)
     }
     else if (Paint.Scale == 65)
     {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++)
+        UWORD *pDst = (UWORD *)Paint.Image;
+        UDOUBLE Count = (UDOUBLE)Paint.WidthByte / 2 * Paint.HeightByte;
+        while (Count--)
         {
-            for (UWORD X = 0; X < Paint.WidthByte; X++)
-            { // 8 pixel =  1 byte
-                UDOUBLE Addr = X * 2 + Y * Paint.WidthByte;
-                Paint.Image[Addr] = 0xff & (Color >> 8);
-                Paint.Image[Addr + 1] = 0xff & Color;
-            }
+            *pDst++ = Color;
         }
     }
+    else if (Paint.Scale == PAINT_SCALE_PAGE)
+    {
+        memset(Paint.Image, ((Color & 0xff) == BLACK) ? 0x00 : 0xff, (UDOUBLE)Paint.WidthByte * Paint.HeightByte);
+    }
 }
 
 /******************************************************************************
@@ -515,291 +642,1829 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
 }
 
 /******************************************************************************
-function: Show English characters
-parameter:
-    Xpoint           ：X coordinate
-    Ypoint           ：Y coordinate
-    Acsii_Char       ：To display the English characters
-    Font             ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+function: Integer square root, rounded down
 ******************************************************************************/
-void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
-                    sFONT *Font, UWORD Color_Foreground, UWORD Color_Background)
+static UWORD Paint_Isqrt(UDOUBLE Value)
 {
-    UWORD Page, Column;
+    UDOUBLE Root = 0, Bit = 1UL << 30;
 
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height)
+    while (Bit > Value)
+        Bit >>= 2;
+    while (Bit)
     {
-        Debug("Paint_DrawChar Input exceeds the normal display range\r\n");
-        return;
+        if (Value >= Root + Bit)
+        {
+            Value -= Root + Bit;
+            Root = (Root >> 1) + Bit;
+        }
+        else
+            Root >>= 1;
+        Bit >>= 2;
     }
+    return Root;
+}
 
-    uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
-    const unsigned char *ptr = &Font->table[Char_Offset];
-
-    for (Page = 0; Page < Font->Height; Page++)
-    {
-        for (Column = 0; Column < Font->Width; Column++)
-        {
+/******************************************************************************
+function: Distance from the side of a rounded rectangle to its edge on a row
+parameter:
+    Row    : Row inside the rectangle, 0 is the top
+    Height : Height of the rectangle
+    Radius : Corner radius, at most half the width and height
+******************************************************************************/
+static UWORD Paint_CornerInset(UWORD Row, UWORD Height, UWORD Radius)
+{
+    if (Row >= Height - Row)
+        Row = Height - 1 - Row;
+    if (Row >= Radius)
+        return 0;
 
-            // To determine whether the font background color and screen background color is consistent
-            if (*ptr & (0x80 >> (Column % 8)))
-            {
-                Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Background);
-                // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            }
-            else
-            {
-                Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            }
-            // One pixel is 8 bits
-            if (Column % 8 == 7)
-                ptr++;
-        } // Write a line
-        if (Font->Width % 8 != 0)
-            ptr++;
-    } // Write all
+    // Measured at the pixel center: Dy = Radius - Row - 1/2, in half pixels
+    UDOUBLE Dy2 = 2 * (Radius - Row) - 1;
+    return Radius - (Paint_Isqrt(4UL * Radius * Radius - Dy2 * Dy2) + 1) / 2;
 }
 
 /******************************************************************************
-function:	Display the string
+function: Draw a rounded rectangle
 parameter:
-    Xstart           ：X coordinate
-    Ystart           ：Y coordinate
-    pString          ：The first address of the English string to be displayed
-    Font             ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+    Xstart ：x starting point
+    Ystart ：Y starting point
+    Xend   ：x end point (exclusive)
+    Yend   ：y end point (exclusive)
+    Radius ：Corner radius, limited to half the shorter side
+    Color  ：The color of the rectangle
+    Line_width: Outline width
+    Draw_Fill : Whether to fill the inside of the rectangle
+info:
+    Every row is one span when filled and at most two when outlined.
 ******************************************************************************/
-void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char *pString,
-                         sFONT *Font, UWORD Color_Foreground, UWORD Color_Background)
+void Paint_DrawRoundRect(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Radius,
+                         UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
 {
-    UWORD Xpoint = Xstart;
-    UWORD Ypoint = Ystart;
-
-    if (Xstart > Paint.Width || Ystart > Paint.Height)
+    if (Xstart >= Xend || Ystart >= Yend || Xend > Paint.Width || Yend > Paint.Height)
     {
-        Debug("Paint_DrawString_EN Input exceeds the normal display range\r\n");
+        Debug("Paint_DrawRoundRect Input exceeds the normal display range\r\n");
         return;
     }
 
-    while (*pString != '\0')
+    UWORD Width = Xend - Xstart;
+    UWORD Height = Yend - Ystart;
+    UWORD Line = Line_width;
+    UWORD Row, Outer, Inner, Radius_Inner;
+
+    if (Radius > Width / 2)
+        Radius = Width / 2;
+    if (Radius > Height / 2)
+        Radius = Height / 2;
+    if (Draw_Fill == DRAW_FILL_FULL || 2 * Line >= Width || 2 * Line >= Height)
     {
-        // if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y direction plus the Height of the character
-        if ((Xpoint + Font->Width) > Paint.Width)
+        for (Row = 0; Row < Height; Row++)
         {
-            Xpoint = Xstart;
-            Ypoint += Font->Height;
+            Outer = Paint_CornerInset(Row, Height, Radius);
+            Paint_DrawSpan(Xstart + Outer, Ystart + Row, Width - 2 * Outer, Color);
         }
+        return;
+    }
 
-        // If the Y direction is full, reposition to(Xstart, Ystart)
-        if ((Ypoint + Font->Height) > Paint.Height)
+    // The hole is a rounded rectangle Line pixels smaller on each side
+    Radius_Inner = Radius > Line ? Radius - Line : 0;
+    for (Row = 0; Row < Height; Row++)
+    {
+        Outer = Paint_CornerInset(Row, Height, Radius);
+        if (Row < Line || Row >= Height - Line)
         {
-            Xpoint = Xstart;
-            Ypoint = Ystart;
+            Paint_DrawSpan(Xstart + Outer, Ystart + Row, Width - 2 * Outer, Color);
+            continue;
         }
-        Paint_DrawChar(Xpoint, Ypoint, *pString, Font, Color_Background, Color_Foreground);
-
-        // The next character of the address
-        pString++;
-
-        // The next word of the abscissa increases the font of the broadband
-        Xpoint += Font->Width;
+        Inner = Line + Paint_CornerInset(Row - Line, Height - 2 * Line, Radius_Inner);
+        Paint_DrawSpan(Xstart + Outer, Ystart + Row, Inner - Outer, Color);
+        Paint_DrawSpan(Xend - Inner, Ystart + Row, Inner - Outer, Color);
     }
 }
 
 /******************************************************************************
-function: Display the string
+function: Unit vector of a ring angle in Q14
 parameter:
-    Xstart  ：X coordinate
-    Ystart  ：Y coordinate
-    pString ：The first address of the Chinese string and English
-              string to be displayed
-    Font    ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+    Angle : 0 .. PAINT_RING_TURN, clockwise from 12 o'clock
+info:
+    Single precision, which the M33 FPU does in hardware; the result is
+    within one Q14 step of the double precision one.
 ******************************************************************************/
-void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char *pString, cFONT *font,
-                         UWORD Color_Foreground, UWORD Color_Background)
+static void Paint_RingVector(UWORD Angle, int32_t *Ux, int32_t *Uy)
 {
-    const char *p_text = pString;
-    int x = Xstart, y = Ystart;
-    int i, j, Num;
+    float Rad = Angle * (2 * 3.14159265f / PAINT_RING_TURN);
+    *Ux = (int32_t)lroundf(sinf(Rad) * 16384);
+    *Uy = (int32_t)lroundf(-cosf(Rad) * 16384);
+}
 
-    /* Send the string character by character on LCD */
-    while (*p_text != 0)
-    {
-        if (*p_text <= 0x7F)
-        { // ASCII < 126
-            for (Num = 0; Num < font->size; Num++)
-            {
-                if (*p_text == font->table[Num].index[0])
-                {
-                    const char *ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++)
-                    {
-                        for (i = 0; i < font->Width; i++)
-                        {
-                            if (FONT_BACKGROUND == Color_Background)
-                            { // this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8)))
-                                {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            else
-                            {
-                                if (*ptr & (0x80 >> (i % 8)))
-                                {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                                else
-                                {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7)
-                            {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0)
-                        {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
-            }
-            /* Point on the next character */
-            p_text += 1;
-            /* Decrement the column position by 16 */
-            x += font->ASCII_Width;
-        }
-        else
-        { // Chinese
-            for (Num = 0; Num < font->size; Num++)
-            {
-                if ((*p_text == font->table[Num].index[0]) && (*(p_text + 1) == font->table[Num].index[1]))
-                {
-                    const char *ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++)
-                    {
-                        for (i = 0; i < font->Width; i++)
-                        {
-                            if (FONT_BACKGROUND == Color_Background)
-                            { // this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8)))
-                                {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            else
-                            {
-                                if (*ptr & (0x80 >> (i % 8)))
-                                {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                                else
-                                {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7)
-                            {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0)
-                        {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
-            }
-            /* Point on the next character */
-            p_text += 2;
-            /* Decrement the column position by 16 */
-            x += font->Width;
-        }
-    }
+static inline int32_t Paint_Min(int32_t A, int32_t B)
+{
+    return A < B ? A : B;
+}
+
+static inline int32_t Paint_Max(int32_t A, int32_t B)
+{
+    return A > B ? A : B;
 }
 
 /******************************************************************************
-function:	Display nummber
-parameter:
-    Xstart           ：X coordinate
-    Ystart           : Y coordinate
-    Nummber          : The number displayed
-    Font             ：A structure pointer that displays a character size
-    Digit						 : Fractional width
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+function: Division rounded towards minus infinity
 ******************************************************************************/
-#define ARRAY_LEN 255
-void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, double Nummber,
-                   sFONT *Font, UWORD Digit, UWORD Color_Foreground, UWORD Color_Background)
+static int32_t Paint_FloorDiv(int32_t Num, int32_t Den)
 {
-    char Str[ARRAY_LEN];
-    sprintf(Str, "%.*lf", Digit + 1, Nummber);
-    char *pStr = (char *)malloc((strlen(Str)) * sizeof(char));
-    memcpy(pStr, Str, (strlen(Str) - 1));
-    *(pStr + strlen(Str) - 1) = '\0';
-    if (Digit == 0)
-        *(pStr + strlen(Str) - 2) = '\0';
-    // show
-    Paint_DrawString_EN(Xpoint, Ypoint, (const char *)pStr, Font, Color_Foreground, Color_Background);
-    free(pStr);
-    pStr = NULL;
+    int32_t Quot = Num / Den;
+    if ((Num % Den != 0) && ((Num < 0) != (Den < 0)))
+        Quot--;
+    return Quot;
 }
 
 /******************************************************************************
-function:	Display time
+function: Draw a ring span given relative to the center, clipped to the image
+******************************************************************************/
+static void Paint_RingSpan(PAINT_RING *Ring, int32_t Dx_Start, int32_t Dx_End, int32_t Dy, UWORD Color)
+{
+    Paint_DrawSpanClipped(Ring->X_Center + Dx_Start, Ring->Y_Center + Dy, Dx_End - Dx_Start + 1, Color);
+}
+
+/******************************************************************************
+function: Draw the part of a ring between two angles in one quadrant
 parameter:
-    Xstart           ：X coordinate
-    Ystart           : Y coordinate
-    pTime            : Time-related structures
-    Font             ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
+    Ring        : Ring geometry
+    Angle_Start : First angle, included
+    Angle_End   : Last angle, excluded, in the same quadrant as Angle_Start
+    Color       : Painted colors
+info:
+    A pixel belongs to the sector when it is clockwise of the start vector
+    and not clockwise of the end vector. Both are half-planes, so on each row
+    the sector is one interval of x, cut by the annulus into at most two
+    spans. Adjacent sectors share the boundary test and never overlap.
 ******************************************************************************/
-void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT *Font,
-                    UWORD Color_Foreground, UWORD Color_Background)
+static void Paint_RingSector(PAINT_RING *Ring, UWORD Angle_Start, UWORD Angle_End, UWORD Color)
 {
-    uint8_t value[10] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    int32_t Ax, Ay, Bx, By;
+    int32_t R_Outer = Ring->Radius;
+    int32_t R_Inner = Ring->Radius > Ring->Thickness ? Ring->Radius - Ring->Thickness : 0;
+    int32_t Outer2 = R_Outer * R_Outer + R_Outer;
+    int32_t Inner2 = R_Inner * R_Inner + R_Inner;
+    int32_t Dy, Dy_First, Dy_Last, Lo, Hi, Xo, Xi;
+    UWORD Quadrant = Angle_Start / (PAINT_RING_TURN / 4);
 
-    UWORD Dx = Font->Width;
+    Paint_RingVector(Angle_Start, &Ax, &Ay);
+    Paint_RingVector(Angle_End, &Bx, &By);
 
-    // Write data into the cache
-    Paint_DrawChar(Xstart, Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx, Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx + Dx / 4 + Dx / 2, Ystart, ':', Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 2 + Dx / 2, Ystart, value[pTime->Min / 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 3 + Dx / 2, Ystart, value[pTime->Min % 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':', Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 5, Ystart, value[pTime->Sec / 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 6, Ystart, value[pTime->Sec % 10], Font, Color_Background, Color_Foreground);
-}
+    // Quadrants 0 and 3 are above the center, 1 and 2 below it
+    Dy_First = (Quadrant == 0 || Quadrant == 3) ? -R_Outer : 0;
+    Dy_Last = (Quadrant == 0 || Quadrant == 3) ? 0 : R_Outer;
 
-void Paint_DrawImage(const unsigned char *image, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image)
-{
-    int i, j;
-    for (j = 0; j < H_Image; j++)
+    for (Dy = Dy_First; Dy <= Dy_Last; Dy++)
     {
-        for (i = 0; i < W_Image; i++)
+        Lo = -R_Outer;
+        Hi = R_Outer;
+
+        // Ax * Dy - Ay * Dx >= 0
+        if (Ay > 0)
+            Hi = Paint_Min(Hi, Paint_FloorDiv(Ax * Dy, Ay));
+        else if (Ay < 0)
+            Lo = Paint_Max(Lo, -Paint_FloorDiv(Ax * Dy, -Ay));
+        else if (Ax * Dy < 0)
+            continue;
+        // Bx * Dy - By * Dx < 0
+        if (By > 0)
+            Lo = Paint_Max(Lo, Paint_FloorDiv(Bx * Dy, By) + 1);
+        else if (By < 0)
+            Hi = Paint_Min(Hi, -Paint_FloorDiv(Bx * Dy, -By) - 1);
+        else if (Bx * Dy >= 0)
+            continue;
+
+        Xo = Paint_Isqrt(Outer2 - Dy * Dy);
+        Lo = Paint_Max(Lo, -Xo);
+        Hi = Paint_Min(Hi, Xo);
+        if (Lo > Hi)
+            continue;
+        if (Dy * Dy >= Inner2)
         {
-            if (xStart + i < Paint.WidthMemory && yStart + j < Paint.HeightMemory) // Exceeded part does not display
+            Paint_RingSpan(Ring, Lo, Hi, Dy, Color);
+            continue;
+        }
+        Xi = Paint_Isqrt(Inner2 - 1 - Dy * Dy);
+        if (Lo < -Xi)
+            Paint_RingSpan(Ring, Lo, Paint_Min(Hi, -Xi - 1), Dy, Color);
+        if (Hi > Xi)
+            Paint_RingSpan(Ring, Paint_Max(Lo, Xi + 1), Hi, Dy, Color);
+    }
+}
+
+/******************************************************************************
+function: Draw the part of a ring between two angles
+******************************************************************************/
+static void Paint_RingArc(PAINT_RING *Ring, UWORD Angle_Start, UWORD Angle_End, UWORD Color)
+{
+    UWORD Next;
+    while (Angle_Start < Angle_End)
+    {
+        Next = (Angle_Start / (PAINT_RING_TURN / 4) + 1) * (PAINT_RING_TURN / 4);
+        if (Next > Angle_End)
+            Next = Angle_End;
+        Paint_RingSector(Ring, Angle_Start, Next, Color);
+        Angle_Start = Next;
+    }
+}
+
+/******************************************************************************
+function: Ring value to angle
+******************************************************************************/
+static UWORD Paint_RingAngle(PAINT_RING *Ring, UWORD Value)
+{
+    if (Value > Ring->Max)
+        Value = Ring->Max;
+    return (UDOUBLE)Value * PAINT_RING_TURN / Ring->Max;
+}
+
+/******************************************************************************
+function: Draw a progress ring
+parameter:
+    Ring        : Ring to draw, its geometry and colors set by the caller
+    Value       : Progress, 0 .. Ring->Max
+info:
+    The ring starts at 12 o'clock and fills clockwise. The whole ring is
+    drawn once, Paint_UpdateRing then only touches what changed.
+******************************************************************************/
+void Paint_DrawRing(PAINT_RING *Ring, UWORD Value)
+{
+    if (Ring->Max == 0 || Ring->Radius == 0)
+    {
+        Debug("Paint_DrawRing Ring is not set up\r\n");
+        return;
+    }
+
+    UWORD Angle = Paint_RingAngle(Ring, Value);
+    Paint_RingArc(Ring, 0, Angle, Ring->Color_Fill);
+    Paint_RingArc(Ring, Angle, PAINT_RING_TURN, Ring->Color_Track);
+    Ring->Angle = Angle;
+}
+
+/******************************************************************************
+function: Move a progress ring to a new value
+parameter:
+    Ring        : Ring drawn earlier with Paint_DrawRing
+    Value       : Progress, 0 .. Ring->Max
+info:
+    Only the sector between the old and the new angle is rasterized, in the
+    fill color when the value grew and in the track color when it shrank.
+******************************************************************************/
+void Paint_UpdateRing(PAINT_RING *Ring, UWORD Value)
+{
+    if (Ring->Max == 0 || Ring->Radius == 0)
+    {
+        Debug("Paint_UpdateRing Ring is not set up\r\n");
+        return;
+    }
+
+    UWORD Angle = Paint_RingAngle(Ring, Value);
+    if (Angle > Ring->Angle)
+        Paint_RingArc(Ring, Ring->Angle, Angle, Ring->Color_Fill);
+    else if (Angle < Ring->Angle)
+        Paint_RingArc(Ring, Angle, Ring->Angle, Ring->Color_Track);
+    Ring->Angle = Angle;
+}
+
+/******************************************************************************
+function: Build part of a color ramp between two RGB565 colors
+parameter:
+    Ramp        : Destination, Count entries
+    First       : First entry built
+    Count       : Number of entries built
+    Len         : Length of the whole ramp, entry 0 is Color_Start and entry
+                  Len-1 Color_End
+    Color_Start : First color
+    Color_End   : Last color
+info:
+    Each channel is stepped with a 16.16 fixed-point accumulator. A part
+    starts First steps in, so the parts match the ramp built whole.
+******************************************************************************/
+static void Paint_BuildRamp(UWORD *Ramp, UDOUBLE First, UWORD Count, UDOUBLE Len,
+                            UWORD Color_Start, UWORD Color_End)
+{
+    int32_t R = (int32_t)(Color_Start >> 11) << 16;
+    int32_t G = (int32_t)((Color_Start >> 5) & 0x3f) << 16;
+    int32_t B = (int32_t)(Color_Start & 0x1f) << 16;
+    int32_t R_Step = 0, G_Step = 0, B_Step = 0;
+    UWORD i;
+
+    if (Len > 1)
+    {
+        R_Step = (((int32_t)(Color_End >> 11) << 16) - R) / (int32_t)(Len - 1);
+        G_Step = (((int32_t)((Color_End >> 5) & 0x3f) << 16) - G) / (int32_t)(Len - 1);
+        B_Step = (((int32_t)(Color_End & 0x1f) << 16) - B) / (int32_t)(Len - 1);
+    }
+    R += R_Step * (int32_t)First;
+    G += G_Step * (int32_t)First;
+    B += B_Step * (int32_t)First;
+    for (i = 0; i < Count; i++)
+    {
+        Ramp[i] = ((R + 0x8000) >> 16) << 11 | ((G + 0x8000) >> 16) << 5 | ((B + 0x8000) >> 16);
+        R += R_Step;
+        G += G_Step;
+        B += B_Step;
+    }
+}
+
+/**
+ * Ramp and line scratch of the fills
+**/
+static UWORD Paint_Ramp[PAINT_LINE_MAX * 2];
+static UWORD Paint_Line[PAINT_LINE_MAX];
+
+/******************************************************************************
+function: Fill a window with a linear gradient
+parameter:
+    Xstart      : x starting point
+    Ystart      : Y starting point
+    Xend        : x end point (exclusive)
+    Yend        : y end point (exclusive)
+    Color_Start : Color at the start edge
+    Color_End   : Color at the end edge
+    Direction   : GRADIENT_HORIZONTAL, GRADIENT_VERTICAL or GRADIENT_DIAGONAL
+info:
+    The window is filled in blocks of up to PAINT_LINE_MAX columns and
+    rows, with the part of the ramp each block uses built once. A
+    horizontal gradient writes the same row for every line of a block, a
+    vertical one a single color span per line, and a diagonal one a window
+    of the ramp that slides by one entry per line.
+******************************************************************************/
+void Paint_FillLinearGradient(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                              UWORD Color_Start, UWORD Color_End, GRADIENT_DIR Direction)
+{
+    if (Xstart >= Xend || Ystart >= Yend || Xend > Paint.Width || Yend > Paint.Height)
+    {
+        Debug("Paint_FillLinearGradient Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    UWORD Width = Xend - Xstart;
+    UWORD Height = Yend - Ystart;
+    UWORD X, Y, Row, Cols, Rows;
+
+    if (Direction == GRADIENT_VERTICAL)
+    {
+        for (Y = 0; Y < Height; Y += Rows)
+        {
+            Rows = (Height - Y < PAINT_LINE_MAX * 2) ? Height - Y : PAINT_LINE_MAX * 2;
+            Paint_BuildRamp(Paint_Ramp, Y, Rows, Height, Color_Start, Color_End);
+            for (Row = 0; Row < Rows; Row++)
+                Paint_DrawSpan(Xstart, Ystart + Y + Row, Width, Paint_Ramp[Row]);
+        }
+        return;
+    }
+
+    for (X = 0; X < Width; X += Cols)
+    {
+        Cols = (Width - X < PAINT_LINE_MAX) ? Width - X : PAINT_LINE_MAX;
+        if (Direction == GRADIENT_HORIZONTAL)
+        {
+            Paint_BuildRamp(Paint_Ramp, X, Cols, Width, Color_Start, Color_End);
+            for (Y = Ystart; Y < Yend; Y++)
+                Paint_DrawRow(Xstart + X, Y, Cols, Paint_Ramp);
+            continue;
+        }
+        // a block of Rows lines uses Rows + Cols - 1 entries, from X + Y on
+        for (Y = 0; Y < Height; Y += Rows)
+        {
+            Rows = (Height - Y < PAINT_LINE_MAX) ? Height - Y : PAINT_LINE_MAX;
+            Paint_BuildRamp(Paint_Ramp, X + Y, Rows + Cols - 1, (UDOUBLE)Width + Height - 1,
+                            Color_Start, Color_End);
+            for (Row = 0; Row < Rows; Row++)
+                Paint_DrawRow(Xstart + X, Ystart + Y + Row, Cols, &Paint_Ramp[Row]);
+        }
+    }
+}
+
+/******************************************************************************
+function: Fill a window with a radial gradient
+parameter:
+    Xstart       : x starting point
+    Ystart       : Y starting point
+    Xend         : x end point (exclusive)
+    Yend         : y end point (exclusive)
+    X_Center     : Center X coordinate
+    Y_Center     : Center Y coordinate
+    Radius       : Distance at which Color_Edge is reached
+    Color_Center : Color at the center
+    Color_Edge   : Color at Radius and beyond
+info:
+    The ramp is indexed by the integer distance to the center. Along a line
+    the squared distance changes by 2 * dx + 1 per pixel, so the distance is
+    tracked incrementally instead of taking a square root per pixel. Lines
+    are written in blocks of up to PAINT_LINE_MAX columns. The ramp holds
+    PAINT_LINE_MAX * 2 entries, a larger Radius is reduced to fit.
+******************************************************************************/
+void Paint_FillRadialGradient(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                              UWORD X_Center, UWORD Y_Center, UWORD Radius,
+                              UWORD Color_Center, UWORD Color_Edge)
+{
+    if (Xstart >= Xend || Ystart >= Yend || Xend > Paint.Width || Yend > Paint.Height)
+    {
+        Debug("Paint_FillRadialGradient Input exceeds the normal display range\r\n");
+        return;
+    }
+    if (Radius >= PAINT_LINE_MAX * 2)
+        Radius = PAINT_LINE_MAX * 2 - 1;
+
+    UWORD Width = Xend - Xstart;
+    UWORD X, Y, Col, Cols;
+    int32_t Dx, Dy, Dist2, Dist = 0;
+
+    Paint_BuildRamp(Paint_Ramp, 0, Radius + 1, Radius + 1, Color_Center, Color_Edge);
+
+    for (X = 0; X < Width; X += Cols)
+    {
+        Cols = (Width - X < PAINT_LINE_MAX) ? Width - X : PAINT_LINE_MAX;
+        for (Y = Ystart; Y < Yend; Y++)
+        {
+            Dy = (int32_t)Y - Y_Center;
+            Dx = (int32_t)Xstart + X - X_Center;
+            Dist2 = Dx * Dx + Dy * Dy;
+            // Dist carries over from the previous line, which is at most a
+            // few steps away
+            while (Dist * Dist > Dist2)
+                Dist--;
+            while ((Dist + 1) * (Dist + 1) <= Dist2)
+                Dist++;
+
+            for (Col = 0; Col < Cols; Col++)
+            {
+                Paint_Line[Col] = Paint_Ramp[Dist < Radius ? Dist : Radius];
+
+                Dist2 += 2 * Dx + 1;
+                Dx++;
+                while (Dist * Dist > Dist2)
+                    Dist--;
+                while ((Dist + 1) * (Dist + 1) <= Dist2)
+                    Dist++;
+            }
+            Paint_DrawRow(Xstart + X, Y, Cols, Paint_Line);
+        }
+    }
+}
+
+/******************************************************************************
+function: Fill a window with a tiled two color pattern
+parameter:
+    Xstart   : x starting point
+    Ystart   : Y starting point
+    Xend     : x end point (exclusive)
+    Yend     : y end point (exclusive)
+    pPattern : 1 bit per pixel tile, rows padded to a whole byte
+    W_Tile   : Tile width
+    H_Tile   : Tile height
+    Color_Foreground : Color of set bits
+    Color_Background : Color of clear bits
+info:
+    The tile is anchored at (Xstart, Ystart). The window is filled in blocks
+    of up to PAINT_LINE_MAX columns; in each block a tile row is expanded
+    into a line once and then written to every line that uses it.
+******************************************************************************/
+void Paint_FillPattern(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                       const unsigned char *pPattern, UWORD W_Tile, UWORD H_Tile,
+                       UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Xstart >= Xend || Ystart >= Yend || Xend > Paint.Width || Yend > Paint.Height ||
+        W_Tile == 0 || H_Tile == 0)
+    {
+        Debug("Paint_FillPattern Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    UWORD Width = Xend - Xstart;
+    UWORD Byte_Width = (W_Tile + 7) / 8;
+    UWORD Palette[2] = {Color_Background, Color_Foreground};
+    UWORD X, Y, Row, Col, Cols, i;
+
+    for (X = 0; X < Width; X += Cols)
+    {
+        Cols = (Width - X < PAINT_LINE_MAX) ? Width - X : PAINT_LINE_MAX;
+        for (Row = 0; Row < H_Tile && Ystart + Row < Yend; Row++)
+        {
+            const unsigned char *pRow = pPattern + Row * Byte_Width;
+            for (i = 0, Col = X % W_Tile; i < Cols; i++)
+            {
+                Paint_Line[i] = Palette[(pRow[Col / 8] >> (7 - Col % 8)) & 0x01];
+                if (++Col == W_Tile)
+                    Col = 0;
+            }
+            for (Y = Ystart + Row; Y < Yend; Y += H_Tile)
+                Paint_DrawRow(Xstart + X, Y, Cols, Paint_Line);
+        }
+    }
+}
+
+/******************************************************************************
+function: Show English characters
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           ：Y coordinate
+    Acsii_Char       ：To display the English characters
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                    sFONT *Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Page, Column;
+
+    if (Xpoint > Paint.Width || Ypoint > Paint.Height)
+    {
+        Debug("Paint_DrawChar Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
+    const unsigned char *ptr = &Font->table[Char_Offset];
+
+    for (Page = 0; Page < Font->Height; Page++)
+    {
+        for (Column = 0; Column < Font->Width; Column++)
+        {
+
+            // To determine whether the font background color and screen background color is consistent
+            if (*ptr & (0x80 >> (Column % 8)))
+            {
+                Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Background);
+                // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+            }
+            else
+            {
+                Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
+                // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+            }
+            // One pixel is 8 bits
+            if (Column % 8 == 7)
+                ptr++;
+        } // Write a line
+        if (Font->Width % 8 != 0)
+            ptr++;
+    } // Write all
+}
+
+/******************************************************************************
+function: Draw only the set bits of a glyph
+parameter:
+    Xpoint : X coordinate
+    Ypoint : Y coordinate
+    ptr    : First row of the glyph, rows padded to a whole byte
+    Width  : Glyph width, at most 32 pixels
+    Height : Glyph height
+    Color  : Select the foreground color
+info:
+    Each row is loaded into one word, then count-leading-zeros skips the
+    background and finds the length of each foreground run, which is written
+    as a single span. Background pixels are never touched.
+******************************************************************************/
+static void Paint_DrawGlyphRuns(UWORD Xpoint, UWORD Ypoint, const unsigned char *ptr,
+                                UWORD Width, UWORD Height, UWORD Color)
+{
+    UWORD Page, Column, Run;
+    UWORD Row_Bytes = Width / 8 + (Width % 8 ? 1 : 0);
+    uint32_t Mask = 0xffffffff << (32 - Width);
+    uint32_t Bits;
+
+    for (Page = 0; Page < Height; Page++)
+    {
+        Bits = 0;
+        for (Column = 0; Column < Row_Bytes; Column++)
+            Bits |= (uint32_t)ptr[Column] << (24 - Column * 8);
+        Bits &= Mask;
+        ptr += Row_Bytes;
+
+        Column = 0;
+        while (Bits)
+        {
+            Run = __builtin_clz(Bits); // background before the run
+            Bits <<= Run;
+            Column += Run;
+
+            Run = (~Bits) ? __builtin_clz(~Bits) : 32; // length of the run
+            Bits = (Run < 32) ? (Bits << Run) : 0;
+            Paint_DrawSpan(Xpoint + Column, Ypoint + Page, Run, Color);
+            Column += Run;
+        }
+    }
+}
+
+/******************************************************************************
+function: Show English characters without touching the background
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           ：Y coordinate
+    Acsii_Char       ：To display the English characters
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+******************************************************************************/
+void Paint_DrawChar_Transparent(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                                sFONT *Font, UWORD Color_Foreground)
+{
+    if (Xpoint > Paint.Width || Ypoint > Paint.Height)
+    {
+        Debug("Paint_DrawChar_Transparent Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
+    Paint_DrawGlyphRuns(Xpoint, Ypoint, &Font->table[Char_Offset], Font->Width, Font->Height, Color_Foreground);
+}
+
+/******************************************************************************
+function:	Display the string
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char *pString,
+                         sFONT *Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+
+    if (Xstart > Paint.Width || Ystart > Paint.Height)
+    {
+        Debug("Paint_DrawString_EN Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    while (*pString != '\0')
+    {
+        // if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y direction plus the Height of the character
+        if ((Xpoint + Font->Width) > Paint.Width)
+        {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+
+        // If the Y direction is full, reposition to(Xstart, Ystart)
+        if ((Ypoint + Font->Height) > Paint.Height)
+        {
+            Xpoint = Xstart;
+            Ypoint = Ystart;
+        }
+        Paint_DrawChar(Xpoint, Ypoint, *pString, Font, Color_Background, Color_Foreground);
+
+        // The next character of the address
+        pString++;
+
+        // The next word of the abscissa increases the font of the broadband
+        Xpoint += Font->Width;
+    }
+}
+
+/******************************************************************************
+function:	Display the string without touching the background
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+******************************************************************************/
+void Paint_DrawString_EN_Transparent(UWORD Xstart, UWORD Ystart, const char *pString,
+                                     sFONT *Font, UWORD Color_Foreground)
+{
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+
+    if (Xstart > Paint.Width || Ystart > Paint.Height)
+    {
+        Debug("Paint_DrawString_EN_Transparent Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    while (*pString != '\0')
+    {
+        if ((Xpoint + Font->Width) > Paint.Width)
+        {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+        if ((Ypoint + Font->Height) > Paint.Height)
+        {
+            Xpoint = Xstart;
+            Ypoint = Ystart;
+        }
+        Paint_DrawChar_Transparent(Xpoint, Ypoint, *pString, Font, Color_Foreground);
+
+        pString++;
+        Xpoint += Font->Width;
+    }
+}
+
+/******************************************************************************
+function: Look up a glyph of a proportional font
+******************************************************************************/
+static const pGLYPH *Paint_Glyph_P(pFONT *Font, char Acsii_Char)
+{
+    UBYTE Code = Acsii_Char;
+    if (Code < Font->first || Code > Font->last)
+        return NULL;
+    return &Font->glyph[Code - Font->first];
+}
+
+/******************************************************************************
+function: Kerning between two characters of a proportional font
+info:
+    Binary search over the pairs, which are sorted by left then right.
+******************************************************************************/
+static int Paint_Kern_P(pFONT *Font, char Left, char Right)
+{
+    UWORD Key = (UBYTE)Left << 8 | (UBYTE)Right;
+    UWORD Lo = 0, Hi = Font->kern_size;
+
+    while (Lo < Hi)
+    {
+        UWORD Mid = (Lo + Hi) / 2;
+        UWORD Pair = Font->kern[Mid].left << 8 | Font->kern[Mid].right;
+        if (Pair == Key)
+            return Font->kern[Mid].adjust;
+        if (Pair < Key)
+            Lo = Mid + 1;
+        else
+            Hi = Mid;
+    }
+    return 0;
+}
+
+/******************************************************************************
+function: Read 32 bits starting at any bit of a packed bitmap
+******************************************************************************/
+static inline uint32_t Paint_BitsAt(const uint8_t *pBits, UDOUBLE Bit)
+{
+    const uint8_t *p = pBits + Bit / 8;
+    uint32_t Word = (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+    UBYTE Shift = Bit % 8;
+    return Shift ? (Word << Shift | p[4] >> (8 - Shift)) : Word;
+}
+
+/******************************************************************************
+function: Draw the set bits of a bit-packed glyph
+parameter:
+    Xpoint : Left of the glyph box
+    Ypoint : Top of the glyph box
+    pBits  : Rows of Width bits each, not padded
+    Width  : Box width
+    Height : Box height
+    Color  : Select the foreground color
+info:
+    Rows are read 32 bits at a time and each run of set bits is one span;
+    a run crossing a 32 bit boundary is joined before it is drawn.
+******************************************************************************/
+static void Paint_DrawPackedRuns(int32_t Xpoint, int32_t Ypoint, const uint8_t *pBits,
+                                 UWORD Width, UWORD Height, UWORD Color)
+{
+    int32_t X = Xpoint;
+    int32_t Y = Ypoint;
+    UDOUBLE Bit = 0;
+    UWORD Row, Column, Chunk, Pos, Run, Run_Start, Run_Len;
+    uint32_t Bits;
+
+    for (Row = 0; Row < Height; Row++, Y++, Bit += Width)
+    {
+        Run_Start = 0;
+        Run_Len = 0;
+        for (Column = 0; Column < Width; Column += Chunk)
+        {
+            Chunk = Width - Column < 32 ? Width - Column : 32;
+            Bits = Paint_BitsAt(pBits, Bit + Column) & (0xffffffff << (32 - Chunk));
+
+            Pos = Column;
+            while (Bits)
+            {
+                Run = __builtin_clz(Bits); // background before the run
+                Bits <<= Run;
+                Pos += Run;
+
+                Run = (~Bits) ? __builtin_clz(~Bits) : 32; // length of the run
+                Bits = (Run < 32) ? (Bits << Run) : 0;
+                if (Run_Len && Run_Start + Run_Len == Pos)
+                {
+                    Run_Len += Run;
+                }
+                else
+                {
+                    if (Run_Len)
+                        Paint_DrawSpanClipped(X + Run_Start, Y, Run_Len, Color);
+                    Run_Start = Pos;
+                    Run_Len = Run;
+                }
+                Pos += Run;
+            }
+        }
+        if (Run_Len)
+            Paint_DrawSpanClipped(X + Run_Start, Y, Run_Len, Color);
+    }
+}
+
+/******************************************************************************
+function: Width of a string in a proportional font
+parameter:
+    pString ：The string to measure
+    Font    ：A structure pointer that displays a character size
+info:
+    The sum of the advances and kerning, as Paint_DrawString_P moves the
+    pen on a single line.
+******************************************************************************/
+UWORD Paint_StringWidth_P(const char *pString, pFONT *Font)
+{
+    const pGLYPH *Glyph;
+    int32_t Width = 0;
+
+    for (; *pString != '\0'; pString++)
+    {
+        Glyph = Paint_Glyph_P(Font, *pString);
+        if (Glyph == NULL)
+            continue;
+        Width += Glyph->advance + Paint_Kern_P(Font, pString[0], pString[1]);
+    }
+    return Width > 0 ? Width : 0;
+}
+
+/******************************************************************************
+function: Draw a string in a proportional font
+parameter:
+    Opaque : Fill the background of each advance with Color_Background
+info:
+    Characters missing from the font are skipped. The background of each
+    advance is filled from where the previous one ended, so a kerned pair
+    does not erase the glyph before it.
+******************************************************************************/
+static void Paint_PutString_P(UWORD Xstart, UWORD Ystart, const char *pString, pFONT *Font,
+                              UWORD Color_Foreground, UWORD Color_Background, UBYTE Opaque)
+{
+    const pGLYPH *Glyph;
+    int32_t Xpoint = Xstart, Ypoint = Ystart, Filled = Xstart;
+    UWORD Row;
+
+    for (; *pString != '\0'; pString++)
+    {
+        Glyph = Paint_Glyph_P(Font, *pString);
+        if (Glyph == NULL)
+            continue;
+
+        if ((Xpoint + Glyph->advance) > Paint.Width)
+        {
+            Xpoint = Filled = Xstart;
+            Ypoint += Font->Height;
+        }
+        if ((Ypoint + Font->Height) > Paint.Height)
+        {
+            Xpoint = Filled = Xstart;
+            Ypoint = Ystart;
+        }
+
+        if (Opaque)
+        {
+            if (Filled < Xpoint)
+                Filled = Xpoint;
+            for (Row = 0; Row < Font->Height; Row++)
+                Paint_DrawSpanClipped(Filled, Ypoint + Row, Xpoint + Glyph->advance - Filled, Color_Background);
+            Filled = Xpoint + Glyph->advance;
+        }
+        Paint_DrawPackedRuns(Xpoint + Glyph->x_offset, Ypoint + Glyph->y_offset, Font->bitmap + Glyph->offset,
+                             Glyph->Width, Glyph->Height, Color_Foreground);
+
+        Xpoint += Glyph->advance + Paint_Kern_P(Font, pString[0], pString[1]);
+    }
+}
+
+/******************************************************************************
+function: Display a string in a proportional font
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_DrawString_P(UWORD Xstart, UWORD Ystart, const char *pString, pFONT *Font,
+                        UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Xstart > Paint.Width || Ystart > Paint.Height)
+    {
+        Debug("Paint_DrawString_P Input exceeds the normal display range\r\n");
+        return;
+    }
+    Paint_PutString_P(Xstart, Ystart, pString, Font, Color_Foreground, Color_Background, 1);
+}
+
+/******************************************************************************
+function: Display a string in a proportional font without touching the background
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+******************************************************************************/
+void Paint_DrawString_P_Transparent(UWORD Xstart, UWORD Ystart, const char *pString, pFONT *Font,
+                                    UWORD Color_Foreground)
+{
+    if (Xstart > Paint.Width || Ystart > Paint.Height)
+    {
+        Debug("Paint_DrawString_P_Transparent Input exceeds the normal display range\r\n");
+        return;
+    }
+    Paint_PutString_P(Xstart, Ystart, pString, Font, Color_Foreground, 0, 0);
+}
+
+/******************************************************************************
+function:	Display time in a proportional font
+parameter:
+    Xstart           ：X coordinate
+    Ystart           : Y coordinate
+    pTime            : Time-related structures
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Digits share one advance in the generated fonts, so the colons sit
+    tight without hand-placed offsets and the width does not change as
+    the time ticks.
+******************************************************************************/
+void Paint_DrawTime_P(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, pFONT *Font,
+                      UWORD Color_Foreground, UWORD Color_Background)
+{
+    char Str[9] = {
+        '0' + pTime->Hour / 10, '0' + pTime->Hour % 10, ':',
+        '0' + pTime->Min / 10, '0' + pTime->Min % 10, ':',
+        '0' + pTime->Sec / 10, '0' + pTime->Sec % 10, '\0'};
+
+    Paint_DrawString_P(Xstart, Ystart, Str, Font, Color_Foreground, Color_Background);
+}
+
+/******************************************************************************
+function: Draw one row of a run-length coded glyph
+parameter:
+    Xpoint : Left of the glyph box
+    Ypoint : Row coordinate
+    pRuns  : First run byte of the row
+    Width  : Box width
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+    Opaque : Draw the background runs
+info:
+    Returns the first run byte of the next row.
+******************************************************************************/
+static const uint8_t *Paint_DrawRunRow(int32_t Xpoint, int32_t Ypoint, const uint8_t *pRuns, UWORD Width,
+                                       UWORD Color_Foreground, UWORD Color_Background, UBYTE Opaque)
+{
+    UWORD Pos = 0, Background, Foreground;
+    uint8_t Run;
+
+    do
+    {
+        Run = *pRuns++;
+        Background = (Run >> 4) & 0x07;
+        Foreground = Run & 0x0f;
+        if (Background && Opaque)
+            Paint_DrawSpanClipped(Xpoint + Pos, Ypoint, Background, Color_Background);
+        Pos += Background;
+        if (Foreground)
+            Paint_DrawSpanClipped(Xpoint + Pos, Ypoint, Foreground, Color_Foreground);
+        Pos += Foreground;
+    } while ((Run & 0x80) == 0);
+
+    if (Pos < Width && Opaque)
+        Paint_DrawSpanClipped(Xpoint + Pos, Ypoint, Width - Pos, Color_Background);
+    return pRuns;
+}
+
+/******************************************************************************
+function: Draw a character of a run-length coded font
+parameter:
+    Opaque : Fill the cell with Color_Background
+info:
+    The runs are drawn as spans and never expanded to bits. With a
+    background the cell outside the glyph box is filled as well, every
+    pixel once; without one only the foreground runs are visited.
+******************************************************************************/
+static void Paint_PutChar_R(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, rFONT *Font,
+                            UWORD Color_Foreground, UWORD Color_Background, UBYTE Opaque)
+{
+    const rGLYPH *Glyph = NULL;
+    const uint8_t *pRuns;
+    UBYTE Code = Acsii_Char;
+    int32_t Row, Box_Left, Box_Right;
+
+    if (Code >= Font->first && Code <= Font->last && Font->glyph[Code - Font->first].Height != 0)
+        Glyph = &Font->glyph[Code - Font->first];
+
+    if (Glyph == NULL)
+    {
+        if (Opaque)
+        {
+            for (Row = 0; Row < Font->Height; Row++)
+                Paint_DrawSpanClipped(Xpoint, Ypoint + Row, Font->Width, Color_Background);
+        }
+        return;
+    }
+
+    pRuns = Font->runs + Glyph->offset;
+    Box_Left = Glyph->x_offset;
+    Box_Right = Glyph->x_offset + Glyph->Width;
+    for (Row = 0; Row < Font->Height; Row++)
+    {
+        if (Row < Glyph->y_offset || Row >= Glyph->y_offset + Glyph->Height)
+        {
+            if (Opaque)
+                Paint_DrawSpanClipped(Xpoint, Ypoint + Row, Font->Width, Color_Background);
+            continue;
+        }
+        if (Opaque)
+        {
+            if (Box_Left > 0)
+                Paint_DrawSpanClipped(Xpoint, Ypoint + Row, Box_Left, Color_Background);
+            if (Box_Right < Font->Width)
+                Paint_DrawSpanClipped(Xpoint + Box_Right, Ypoint + Row, Font->Width - Box_Right, Color_Background);
+        }
+        pRuns = Paint_DrawRunRow(Xpoint + Box_Left, Ypoint + Row, pRuns, Glyph->Width,
+                                 Color_Foreground, Color_Background, Opaque);
+    }
+}
+
+/******************************************************************************
+function: Show a character of a run-length coded font
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           ：Y coordinate
+    Acsii_Char       ：To display the English characters
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_DrawChar_R(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                      rFONT *Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Xpoint > Paint.Width || Ypoint > Paint.Height)
+    {
+        Debug("Paint_DrawChar_R Input exceeds the normal display range\r\n");
+        return;
+    }
+    Paint_PutChar_R(Xpoint, Ypoint, Acsii_Char, Font, Color_Foreground, Color_Background, 1);
+}
+
+/******************************************************************************
+function: Show a character of a run-length coded font without touching the background
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           ：Y coordinate
+    Acsii_Char       ：To display the English characters
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+******************************************************************************/
+void Paint_DrawChar_R_Transparent(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                                  rFONT *Font, UWORD Color_Foreground)
+{
+    if (Xpoint > Paint.Width || Ypoint > Paint.Height)
+    {
+        Debug("Paint_DrawChar_R_Transparent Input exceeds the normal display range\r\n");
+        return;
+    }
+    Paint_PutChar_R(Xpoint, Ypoint, Acsii_Char, Font, Color_Foreground, 0, 0);
+}
+
+/******************************************************************************
+function: Draw a string in a run-length coded font
+parameter:
+    Opaque : Fill the cells with Color_Background
+******************************************************************************/
+static void Paint_PutString_R(UWORD Xstart, UWORD Ystart, const char *pString, rFONT *Font,
+                              UWORD Color_Foreground, UWORD Color_Background, UBYTE Opaque)
+{
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+
+    while (*pString != '\0')
+    {
+        if ((Xpoint + Font->Width) > Paint.Width)
+        {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+        if ((Ypoint + Font->Height) > Paint.Height)
+        {
+            Xpoint = Xstart;
+            Ypoint = Ystart;
+        }
+        Paint_PutChar_R(Xpoint, Ypoint, *pString, Font, Color_Foreground, Color_Background, Opaque);
+
+        pString++;
+        Xpoint += Font->Width;
+    }
+}
+
+/******************************************************************************
+function:	Display a string in a run-length coded font
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_DrawString_R(UWORD Xstart, UWORD Ystart, const char *pString,
+                        rFONT *Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Xstart > Paint.Width || Ystart > Paint.Height)
+    {
+        Debug("Paint_DrawString_R Input exceeds the normal display range\r\n");
+        return;
+    }
+    Paint_PutString_R(Xstart, Ystart, pString, Font, Color_Foreground, Color_Background, 1);
+}
+
+/******************************************************************************
+function:	Display a string in a run-length coded font without touching the background
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+******************************************************************************/
+void Paint_DrawString_R_Transparent(UWORD Xstart, UWORD Ystart, const char *pString,
+                                    rFONT *Font, UWORD Color_Foreground)
+{
+    if (Xstart > Paint.Width || Ystart > Paint.Height)
+    {
+        Debug("Paint_DrawString_R_Transparent Input exceeds the normal display range\r\n");
+        return;
+    }
+    Paint_PutString_R(Xstart, Ystart, pString, Font, Color_Foreground, 0, 0);
+}
+
+/******************************************************************************
+function: Draw one GB2312 font glyph
+parameter:
+    x       ：X coordinate
+    y       ：Y coordinate
+    ptr     ：Glyph matrix
+    font    ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    A background of FONT_BACKGROUND is treated as transparent and only the
+    foreground runs are drawn.
+******************************************************************************/
+static void Paint_DrawGlyph_CN(int x, int y, const char *ptr, cFONT *font,
+                               UWORD Color_Foreground, UWORD Color_Background)
+{
+    int i, j;
+
+    if (FONT_BACKGROUND == Color_Background)
+    {
+        Paint_DrawGlyphRuns(x, y, (const unsigned char *)ptr, font->Width, font->Height, Color_Foreground);
+        return;
+    }
+
+    for (j = 0; j < font->Height; j++)
+    {
+        for (i = 0; i < font->Width; i++)
+        {
+            if (*ptr & (0x80 >> (i % 8)))
+            {
+                Paint_SetPixel(x + i, y + j, Color_Foreground);
+            }
+            else
+            {
+                Paint_SetPixel(x + i, y + j, Color_Background);
+            }
+            if (i % 8 == 7)
+            {
+                ptr++;
+            }
+        }
+        if (font->Width % 8 != 0)
+        {
+            ptr++;
+        }
+    }
+}
+
+/******************************************************************************
+function: Find a glyph of a GB2312 font
+parameter:
+    font ：A structure pointer that displays a character size
+    Code ：index[0] << 8 | index[1], an ASCII character is Char << 8
+info:
+    Binary search over the generated index; a font built without one is
+    scanned in table order.
+******************************************************************************/
+static const char *Paint_FindGlyph_CN(cFONT *font, UWORD Code)
+{
+    UWORD Num;
+
+    if (font->index != NULL)
+    {
+        UWORD Lo = 0, Hi = font->index_size;
+        while (Lo < Hi)
+        {
+            UWORD Mid = (Lo + Hi) / 2;
+            if (font->index[Mid].code < Code)
+                Lo = Mid + 1;
+            else
+                Hi = Mid;
+        }
+        if (Lo < font->index_size && font->index[Lo].code == Code)
+            return font->table[font->index[Lo].glyph].matrix;
+        return NULL;
+    }
+
+    for (Num = 0; Num < font->size; Num++)
+    {
+        if (((UBYTE)font->table[Num].index[0] << 8 | (UBYTE)font->table[Num].index[1]) == Code)
+            return font->table[Num].matrix;
+    }
+    return NULL;
+}
+
+/******************************************************************************
+function: Display the string
+parameter:
+    Xstart  ：X coordinate
+    Ystart  ：Y coordinate
+    pString ：The first address of the Chinese string and English
+              string to be displayed
+    Font    ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char *pString, cFONT *font,
+                         UWORD Color_Foreground, UWORD Color_Background)
+{
+    const char *p_text = pString;
+    const char *ptr;
+    int x = Xstart, y = Ystart;
+
+    /* Send the string character by character on LCD */
+    while (*p_text != 0)
+    {
+        if (*p_text <= 0x7F)
+        { // ASCII < 126
+            ptr = Paint_FindGlyph_CN(font, (UBYTE)p_text[0] << 8);
+            if (ptr != NULL)
+                Paint_DrawGlyph_CN(x, y, ptr, font, Color_Foreground, Color_Background);
+            /* Point on the next character */
+            p_text += 1;
+            /* Decrement the column position by 16 */
+            x += font->ASCII_Width;
+        }
+        else
+        { // Chinese
+            ptr = Paint_FindGlyph_CN(font, (UBYTE)p_text[0] << 8 | (UBYTE)p_text[1]);
+            if (ptr != NULL)
+                Paint_DrawGlyph_CN(x, y, ptr, font, Color_Foreground, Color_Background);
+            /* Point on the next character */
+            p_text += 2;
+            /* Decrement the column position by 16 */
+            x += font->Width;
+        }
+    }
+}
+
+/**
+ * Sequence length by the top four bits of a UTF-8 lead byte, 0 when the
+ * byte can not start a sequence
+**/
+static const UBYTE Paint_UTF8_Length[16] = {1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 2, 2, 3, 4};
+static const UBYTE Paint_UTF8_Lead_Mask[5] = {0, 0x7f, 0x1f, 0x0f, 0x07};
+
+/**
+ * ASCII letters that U+00C0 .. U+00FF are drawn as when the font has no
+ * glyph for them, 0 for no sensible substitute
+**/
+static const char Paint_Latin1_Fold[64] =
+    "AAAAAAACEEEEIIII" "DNOOOOO\0OUUUUY\0s"
+    "aaaaaaaceeeeiiii" "dnooooo\0ouuuuy\0y";
+
+/******************************************************************************
+function: Decode one UTF-8 character
+parameter:
+    ppString : Current position, moved past the character
+info:
+    Malformed input yields U+FFFD and skips a single byte.
+******************************************************************************/
+static inline uint32_t Paint_DecodeUTF8(const char **ppString)
+{
+    const UBYTE *p = (const UBYTE *)*ppString;
+    UBYTE Len = Paint_UTF8_Length[p[0] >> 4];
+    uint32_t Code = p[0] & Paint_UTF8_Lead_Mask[Len];
+    UBYTE i;
+
+    for (i = 1; i < Len; i++)
+    {
+        if ((p[i] & 0xc0) != 0x80)
+        {
+            Len = 0;
+            break;
+        }
+        Code = Code << 6 | (p[i] & 0x3f);
+    }
+    if (Len == 0)
+    {
+        *ppString += 1;
+        return 0xfffd;
+    }
+    *ppString += Len;
+    return Code;
+}
+
+/******************************************************************************
+function: Find the glyph of a code point
+parameter:
+    Code  : Unicode code point
+    Fonts : Fonts to search
+    Glyph : Result, Bitmap is NULL for the fallback box
+info:
+    Codes up to 0xFF come from Prop, then printable ASCII from Ascii,
+    everything else from the Unicode index of Cjk. Accented Latin-1
+    letters missing from all of them fall back to their base letter
+    before the box is used.
+******************************************************************************/
+static void Paint_ResolveGlyph(uint32_t Code, PAINT_FONT_SET *Fonts, PAINT_GLYPH *Glyph)
+{
+    Glyph->Code = Code <= 0xffff ? Code : 0xfffd;
+    Glyph->X_Offset = 0;
+    Glyph->Y_Offset = 0;
+    Glyph->Packed = 0;
+
+    if (Fonts->Prop != NULL && Code >= Fonts->Prop->first && Code <= Fonts->Prop->last)
+    {
+        const pGLYPH *pGlyph = &Fonts->Prop->glyph[Code - Fonts->Prop->first];
+        if (pGlyph->advance != 0)
+        {
+            Glyph->Bitmap = Fonts->Prop->bitmap + pGlyph->offset;
+            Glyph->Width = pGlyph->Width;
+            Glyph->Height = pGlyph->Height;
+            Glyph->Advance = pGlyph->advance;
+            Glyph->X_Offset = pGlyph->x_offset;
+            Glyph->Y_Offset = pGlyph->y_offset;
+            Glyph->Packed = 1;
+            return;
+        }
+    }
+
+    if (Code >= 0x20 && Code < 0x7f && Fonts->Ascii != NULL)
+    {
+        sFONT *Ascii = Fonts->Ascii;
+        UWORD Row_Bytes = Ascii->Width / 8 + (Ascii->Width % 8 ? 1 : 0);
+        Glyph->Bitmap = &Ascii->table[(Code - ' ') * Ascii->Height * Row_Bytes];
+        Glyph->Width = Glyph->Advance = Ascii->Width;
+        Glyph->Height = Ascii->Height;
+        return;
+    }
+
+    if (Fonts->Cjk != NULL && Fonts->Cjk->uindex != NULL && Code <= 0xffff)
+    {
+        cFONT *Cjk = Fonts->Cjk;
+        UWORD Lo = 0, Hi = Cjk->uindex_size;
+        while (Lo < Hi)
+        {
+            UWORD Mid = (Lo + Hi) / 2;
+            if (Cjk->uindex[Mid].code < Code)
+                Lo = Mid + 1;
+            else
+                Hi = Mid;
+        }
+        if (Lo < Cjk->uindex_size && Cjk->uindex[Lo].code == Code)
+        {
+            Glyph->Bitmap = (const unsigned char *)Cjk->table[Cjk->uindex[Lo].glyph].matrix;
+            Glyph->Width = Cjk->Width;
+            Glyph->Advance = (Code < 0x80) ? Cjk->ASCII_Width : Cjk->Width;
+            Glyph->Height = Cjk->Height;
+            return;
+        }
+    }
+
+    if (Code >= 0xc0 && Code <= 0xff && Paint_Latin1_Fold[Code - 0xc0] != 0)
+    {
+        Paint_ResolveGlyph(Paint_Latin1_Fold[Code - 0xc0], Fonts, Glyph);
+        return;
+    }
+
+    // Missing: a box the size of the cell the character would have used
+    Glyph->Bitmap = NULL;
+    if (Code >= 0x80 && Fonts->Cjk != NULL)
+    {
+        Glyph->Width = Fonts->Cjk->Width;
+        Glyph->Height = Fonts->Cjk->Height;
+    }
+    else if (Fonts->Ascii != NULL)
+    {
+        Glyph->Width = Fonts->Ascii->Width;
+        Glyph->Height = Fonts->Ascii->Height;
+    }
+    else if (Fonts->Prop != NULL)
+    {
+        Glyph->Width = Fonts->Prop->Height / 2;
+        Glyph->Height = Fonts->Prop->Height;
+    }
+    else
+    {
+        Glyph->Width = Fonts->Cjk->ASCII_Width;
+        Glyph->Height = Fonts->Cjk->Height;
+    }
+    Glyph->Advance = Glyph->Width;
+}
+
+/******************************************************************************
+function: Kerning between two proportional glyphs
+******************************************************************************/
+static int Paint_KernPair(pFONT *Font, UWORD Left, UWORD Right)
+{
+    UWORD Key = Left << 8 | Right;
+    UWORD Lo = 0, Hi = Font->kern_size;
+
+    if (Left > 0xff || Right > 0xff)
+        return 0;
+    while (Lo < Hi)
+    {
+        UWORD Mid = (Lo + Hi) / 2;
+        UWORD Pair = Font->kern[Mid].left << 8 | Font->kern[Mid].right;
+        if (Pair == Key)
+            return Font->kern[Mid].adjust;
+        if (Pair < Key)
+            Lo = Mid + 1;
+        else
+            Hi = Mid;
+    }
+    return 0;
+}
+
+/******************************************************************************
+function: Decode a UTF-8 string into glyphs
+parameter:
+    ppString : Current position, moved past the decoded characters
+    Fonts    : Fonts to search, at least one set
+    Glyphs   : Result, Max entries
+    Max      : Most glyphs to decode
+info:
+    Returns the number of glyphs. Call again until *ppString reaches the
+    terminating zero. A newline is kept as an empty glyph with Code '\n',
+    other control characters are dropped. Kerning with the following
+    character is folded into Advance, looking ahead past the batch.
+******************************************************************************/
+UWORD Paint_ResolveString_UTF8(const char **ppString, PAINT_FONT_SET *Fonts,
+                               PAINT_GLYPH *Glyphs, UWORD Max)
+{
+    UWORD Count = 0;
+    uint32_t Code;
+
+    if (Fonts->Ascii == NULL && Fonts->Prop == NULL && Fonts->Cjk == NULL)
+    {
+        Debug("Paint_ResolveString_UTF8 No font\r\n");
+        *ppString += strlen(*ppString);
+        return 0;
+    }
+
+    while (Count < Max && **ppString != '\0')
+    {
+        Code = Paint_DecodeUTF8(ppString);
+        if (Code == '\n')
+        {
+            PAINT_GLYPH *Glyph = &Glyphs[Count++];
+            memset(Glyph, 0, sizeof(PAINT_GLYPH));
+            Glyph->Code = '\n';
+            continue;
+        }
+        if (Code < 0x20 || Code == 0x7f)
+            continue;
+
+        PAINT_GLYPH *Glyph = &Glyphs[Count++];
+        Paint_ResolveGlyph(Code, Fonts, Glyph);
+        if (Glyph->Packed && Fonts->Prop->kern_size != 0 && **ppString != '\0')
+        {
+            const char *pNext = *ppString;
+            Glyph->Advance += Paint_KernPair(Fonts->Prop, Glyph->Code, Paint_DecodeUTF8(&pNext));
+        }
+    }
+    return Count;
+}
+
+/******************************************************************************
+function: Draw a glyph with its background
+info:
+    Each row is expanded into a line of colors and written at once.
+******************************************************************************/
+static void Paint_DrawGlyphOpaque(UWORD Xpoint, UWORD Ypoint, const unsigned char *ptr,
+                                  UWORD Width, UWORD Height,
+                                  UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Row_Bytes = Width / 8 + (Width % 8 ? 1 : 0);
+    UWORD Page, Column;
+
+    for (Page = 0; Page < Height && Ypoint + Page < Paint.Height; Page++)
+    {
+        for (Column = 0; Column < Width; Column++)
+            Paint_Line[Column] = (ptr[Column / 8] & (0x80 >> (Column % 8))) ? Color_Foreground : Color_Background;
+        Paint_DrawRow(Xpoint, Ypoint + Page, Width, Paint_Line);
+        ptr += Row_Bytes;
+    }
+}
+
+/******************************************************************************
+function: Draw the box that stands for a missing glyph
+******************************************************************************/
+static void Paint_DrawMissingGlyph(UWORD Xpoint, UWORD Ypoint, UWORD Width, UWORD Height,
+                                   UWORD Color_Foreground)
+{
+    UWORD Page;
+
+    for (Page = 0; Page < Height; Page++)
+    {
+        if (Width < 4 || Height < 4 || Page < 1 || Page > Height - 2)
+            continue;
+        if (Page == 1 || Page == Height - 2)
+        {
+            Paint_DrawSpanClipped(Xpoint + 1, Ypoint + Page, Width - 2, Color_Foreground);
+        }
+        else
+        {
+            Paint_DrawSpanClipped(Xpoint + 1, Ypoint + Page, 1, Color_Foreground);
+            Paint_DrawSpanClipped(Xpoint + Width - 2, Ypoint + Page, 1, Color_Foreground);
+        }
+    }
+}
+
+/******************************************************************************
+function: Draw a resolved glyph
+parameter:
+    Line_Height : Height of the background box
+    Opaque      : Fill the background with Color_Background
+info:
+    The background is the box of Advance by Line_Height pixels from the pen
+    and the line top. A fixed cell glyph is written with its background row
+    by row and only the rest of the box is filled; a proportional or
+    missing glyph fills the box before its ink is drawn.
+******************************************************************************/
+static void Paint_PutGlyph(UWORD Xpoint, UWORD Ypoint, const PAINT_GLYPH *Glyph, UWORD Line_Height,
+                           UWORD Color_Foreground, UWORD Color_Background, UBYTE Opaque)
+{
+    UWORD Advance = Glyph->Advance > 0 ? Glyph->Advance : 0;
+    UWORD Row, Filled = 0;
+
+    if (Opaque && Glyph->Bitmap != NULL && !Glyph->Packed)
+    {
+        Paint_DrawGlyphOpaque(Xpoint, Ypoint, Glyph->Bitmap, Glyph->Width, Glyph->Height, Color_Foreground, Color_Background);
+        if (Advance > Glyph->Width)
+        {
+            for (Row = 0; Row < Glyph->Height; Row++)
+                Paint_DrawSpanClipped(Xpoint + Glyph->Width, Ypoint + Row, Advance - Glyph->Width, Color_Background);
+        }
+        Filled = Glyph->Height;
+    }
+    if (Opaque)
+    {
+        for (Row = Filled; Row < Line_Height; Row++)
+            Paint_DrawSpanClipped(Xpoint, Ypoint + Row, Advance, Color_Background);
+    }
+
+    if (Glyph->Bitmap == NULL)
+    {
+        if (Glyph->Width != 0)
+            Paint_DrawMissingGlyph(Xpoint, Ypoint, Glyph->Width, Glyph->Height, Color_Foreground);
+    }
+    else if (Glyph->Packed)
+    {
+        Paint_DrawPackedRuns(Xpoint + Glyph->X_Offset, Ypoint + Glyph->Y_Offset, Glyph->Bitmap,
+                             Glyph->Width, Glyph->Height, Color_Foreground);
+    }
+    else if (!Opaque)
+    {
+        Paint_DrawGlyphRuns(Xpoint, Ypoint, Glyph->Bitmap, Glyph->Width, Glyph->Height, Color_Foreground);
+    }
+}
+
+/******************************************************************************
+function: Draw a resolved glyph with its background
+parameter:
+    Xpoint      ：Pen X coordinate
+    Ypoint      ：Top of the line
+    Glyph       ：Glyph from Paint_ResolveString_UTF8
+    Line_Height ：Height of the line, Paint_LineHeight of the fonts
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    The background covers the advance for the whole line height, so glyphs
+    of different heights leave an even band.
+******************************************************************************/
+void Paint_DrawGlyph(UWORD Xpoint, UWORD Ypoint, const PAINT_GLYPH *Glyph, UWORD Line_Height,
+                     UWORD Color_Foreground, UWORD Color_Background)
+{
+    Paint_PutGlyph(Xpoint, Ypoint, Glyph, Line_Height, Color_Foreground, Color_Background, 1);
+}
+
+/******************************************************************************
+function: Draw only the ink of a resolved glyph
+parameter:
+    Xpoint  ：Pen X coordinate
+    Ypoint  ：Top of the line
+    Glyph   ：Glyph from Paint_ResolveString_UTF8
+    Color_Foreground : Select the foreground color
+******************************************************************************/
+void Paint_DrawGlyph_Transparent(UWORD Xpoint, UWORD Ypoint, const PAINT_GLYPH *Glyph,
+                                 UWORD Color_Foreground)
+{
+    Paint_PutGlyph(Xpoint, Ypoint, Glyph, 0, Color_Foreground, 0, 0);
+}
+
+/******************************************************************************
+function: Draw a UTF-8 string
+parameter:
+    Opaque : Fill the background of each glyph with Color_Background
+info:
+    The string is decoded and looked up PAINT_GLYPH_CHUNK characters at a
+    time, then drawn from the resolved glyphs. Characters neither font has
+    are drawn as an empty box. A newline starts a new line.
+******************************************************************************/
+static void Paint_PutString_UTF8(UWORD Xstart, UWORD Ystart, const char *pString,
+                                 sFONT *Ascii, cFONT *Cjk,
+                                 UWORD Color_Foreground, UWORD Color_Background, UBYTE Opaque)
+{
+    PAINT_GLYPH Glyphs[PAINT_GLYPH_CHUNK];
+    PAINT_FONT_SET Fonts = {Ascii, NULL, Cjk};
+    UWORD Xpoint = Xstart, Ypoint = Ystart;
+    UWORD Line_Height, Count, i;
+
+    if (Ascii == NULL && Cjk == NULL)
+    {
+        Debug("Paint_DrawString_UTF8 No font\r\n");
+        return;
+    }
+
+    Line_Height = Paint_LineHeight(&Fonts);
+    while (*pString != '\0')
+    {
+        Count = Paint_ResolveString_UTF8(&pString, &Fonts, Glyphs, PAINT_GLYPH_CHUNK);
+        for (i = 0; i < Count; i++)
+        {
+            PAINT_GLYPH *Glyph = &Glyphs[i];
+
+            if (Glyph->Code == '\n' || (Xpoint + Glyph->Advance) > Paint.Width)
+            {
+                Xpoint = Xstart;
+                Ypoint += Line_Height;
+            }
+            if ((Ypoint + Line_Height) > Paint.Height)
+            {
+                Xpoint = Xstart;
+                Ypoint = Ystart;
+            }
+            if (Glyph->Code == '\n')
+                continue;
+
+            Paint_PutGlyph(Xpoint, Ypoint, Glyph, Line_Height, Color_Foreground, Color_Background, Opaque);
+            Xpoint += Glyph->Advance;
+        }
+    }
+}
+
+/******************************************************************************
+function: Display a UTF-8 string
+parameter:
+    Xstart  ：X coordinate
+    Ystart  ：Y coordinate
+    pString ：UTF-8 string
+    Ascii   ：Font for printable ASCII, may be NULL to use Cjk
+    Cjk     ：Font for everything else, may be NULL
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_DrawString_UTF8(UWORD Xstart, UWORD Ystart, const char *pString,
+                           sFONT *Ascii, cFONT *Cjk,
+                           UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Xstart > Paint.Width || Ystart > Paint.Height)
+    {
+        Debug("Paint_DrawString_UTF8 Input exceeds the normal display range\r\n");
+        return;
+    }
+    Paint_PutString_UTF8(Xstart, Ystart, pString, Ascii, Cjk, Color_Foreground, Color_Background, 1);
+}
+
+/******************************************************************************
+function: Display a UTF-8 string without touching the background
+parameter:
+    Xstart  ：X coordinate
+    Ystart  ：Y coordinate
+    pString ：UTF-8 string
+    Ascii   ：Font for printable ASCII, may be NULL to use Cjk
+    Cjk     ：Font for everything else, may be NULL
+    Color_Foreground : Select the foreground color
+******************************************************************************/
+void Paint_DrawString_UTF8_Transparent(UWORD Xstart, UWORD Ystart, const char *pString,
+                                       sFONT *Ascii, cFONT *Cjk, UWORD Color_Foreground)
+{
+    if (Xstart > Paint.Width || Ystart > Paint.Height)
+    {
+        Debug("Paint_DrawString_UTF8_Transparent Input exceeds the normal display range\r\n");
+        return;
+    }
+    Paint_PutString_UTF8(Xstart, Ystart, pString, Ascii, Cjk, Color_Foreground, 0, 0);
+}
+
+/******************************************************************************
+function: Line height of a font set, the tallest of its fonts
+******************************************************************************/
+UWORD Paint_LineHeight(PAINT_FONT_SET *Fonts)
+{
+    UWORD Height = 0;
+
+    if (Fonts->Ascii != NULL && Fonts->Ascii->Height > Height)
+        Height = Fonts->Ascii->Height;
+    if (Fonts->Prop != NULL && Fonts->Prop->Height > Height)
+        Height = Fonts->Prop->Height;
+    if (Fonts->Cjk != NULL && Fonts->Cjk->Height > Height)
+        Height = Fonts->Cjk->Height;
+    return Height;
+}
+
+/******************************************************************************
+function:	Display nummber
+parameter:
+    Xstart           ：X coordinate
+    Ystart           : Y coordinate
+    Nummber          : The number displayed
+    Font             ：A structure pointer that displays a character size
+    Digit						 : Fractional width
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+#define ARRAY_LEN 255
+void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, double Nummber,
+                   sFONT *Font, UWORD Digit, UWORD Color_Foreground, UWORD Color_Background)
+{
+    char Str[ARRAY_LEN];
+    sprintf(Str, "%.*lf", Digit + 1, Nummber);
+    char *pStr = (char *)malloc((strlen(Str)) * sizeof(char));
+    memcpy(pStr, Str, (strlen(Str) - 1));
+    *(pStr + strlen(Str) - 1) = '\0';
+    if (Digit == 0)
+        *(pStr + strlen(Str) - 2) = '\0';
+    // show
+    Paint_DrawString_EN(Xpoint, Ypoint, (const char *)pStr, Font, Color_Foreground, Color_Background);
+    free(pStr);
+    pStr = NULL;
+}
+
+/******************************************************************************
+function:	Display time
+parameter:
+    Xstart           ：X coordinate
+    Ystart           : Y coordinate
+    pTime            : Time-related structures
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT *Font,
+                    UWORD Color_Foreground, UWORD Color_Background)
+{
+    uint8_t value[10] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    UWORD Dx = Font->Width;
+
+    // Write data into the cache
+    Paint_DrawChar(Xstart, Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
+    Paint_DrawChar(Xstart + Dx, Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
+    Paint_DrawChar(Xstart + Dx + Dx / 4 + Dx / 2, Ystart, ':', Font, Color_Background, Color_Foreground);
+    Paint_DrawChar(Xstart + Dx * 2 + Dx / 2, Ystart, value[pTime->Min / 10], Font, Color_Background, Color_Foreground);
+    Paint_DrawChar(Xstart + Dx * 3 + Dx / 2, Ystart, value[pTime->Min % 10], Font, Color_Background, Color_Foreground);
+    Paint_DrawChar(Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':', Font, Color_Background, Color_Foreground);
+    Paint_DrawChar(Xstart + Dx * 5, Ystart, value[pTime->Sec / 10], Font, Color_Background, Color_Foreground);
+    Paint_DrawChar(Xstart + Dx * 6, Ystart, value[pTime->Sec % 10], Font, Color_Background, Color_Foreground);
+}
+
+void Paint_DrawImage(const unsigned char *image, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image)
+{
+    int i, j;
+    if (Paint.Scale == 65 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE)
+    {
+        // ImageData.c arrays are low byte first, the order of the image, copy whole rows
+        if (xStart >= Paint.WidthMemory || yStart >= Paint.HeightMemory)
+            return;
+        UWORD Len = W_Image < Paint.WidthMemory - xStart ? W_Image : Paint.WidthMemory - xStart;
+        for (j = 0; j < H_Image && yStart + j < Paint.HeightMemory; j++)
+            memcpy(Paint.Image + xStart * 2 + (yStart + j) * Paint.WidthByte, image + j * W_Image * 2, Len * 2);
+        return;
+    }
+    for (j = 0; j < H_Image; j++)
+    {
+        for (i = 0; i < W_Image; i++)
+        {
+            if (xStart + i < Paint.WidthMemory && yStart + j < Paint.HeightMemory) // Exceeded part does not display
                 Paint_SetPixel(xStart + i, yStart + j, (*(image + j * W_Image * 2 + i * 2 + 1)) << 8 | (*(image + j * W_Image * 2 + i * 2)));
             // Using arrays is a property of sequential storage, accessing the original array by algorithm
             // j*W_Image*2 			   Y offset
@@ -824,6 +2489,138 @@ void Paint_DrawImage1(const unsigned char *image, UWORD xStart, UWORD yStart, UW
     }
 }
 
+/******************************************************************************
+function: Read one pixel of an RGB565 image stored low byte first
+******************************************************************************/
+static inline UWORD Paint_ImagePixel(const unsigned char *image, UWORD W_Image, UWORD X, UWORD Y)
+{
+    const unsigned char *p = image + ((UDOUBLE)Y * W_Image + X) * 2;
+    return p[1] << 8 | p[0];
+}
+
+/******************************************************************************
+function: Blend two RGB565 colors
+parameter:
+    A, B   : Colors spread with Paint_Spread565
+    Weight : Weight of B, 0..32
+info:
+    Spreading puts green in the top half of the word with gaps between the
+    fields, so all three channels are blended with one multiply each side.
+******************************************************************************/
+#define PAINT_SPREAD_MASK 0x07E0F81F
+static inline uint32_t Paint_Spread565(UWORD Color)
+{
+    return (Color | ((uint32_t)Color << 16)) & PAINT_SPREAD_MASK;
+}
+
+static inline uint32_t Paint_Blend565(uint32_t A, uint32_t B, UWORD Weight)
+{
+    return ((A * (32 - Weight) + B * Weight) >> 5) & PAINT_SPREAD_MASK;
+}
+
+/******************************************************************************
+function: Draw some rows of an RGB565 image scaled to a new size
+parameter:
+    image     : Source image, low byte first as in ImageData.c
+    W_Image   : Source width
+    H_Image   : Source height
+    xStart    : X coordinate of the scaled image
+    yStart    : Y coordinate of the first drawn row
+    W_Dst     : Scaled width, at most PAINT_LINE_MAX
+    H_Dst     : Scaled height
+    Row_First : First row of the scaled image to draw
+    Row_Count : Number of rows to draw
+    Filter    : SCALE_NEAREST or SCALE_BILINEAR
+info:
+    Lets a strip buffer receive just its band of the scaled image. Source
+    positions are 16.16 fixed-point accumulators stepped once per pixel and
+    once per row; the only divisions are the two step sizes.
+******************************************************************************/
+void Paint_DrawImageScaledRows(const unsigned char *image, UWORD W_Image, UWORD H_Image,
+                               UWORD xStart, UWORD yStart, UWORD W_Dst, UWORD H_Dst,
+                               UWORD Row_First, UWORD Row_Count, SCALE_FILTER Filter)
+{
+    if (W_Image == 0 || H_Image == 0 || W_Dst == 0 || H_Dst == 0 || Row_First >= H_Dst)
+        return;
+    if (W_Dst > PAINT_LINE_MAX)
+        W_Dst = PAINT_LINE_MAX;
+    if (Row_Count > H_Dst - Row_First)
+        Row_Count = H_Dst - Row_First;
+
+    UDOUBLE X_Step = ((UDOUBLE)W_Image << 16) / W_Dst;
+    UDOUBLE Y_Step = ((UDOUBLE)H_Image << 16) / H_Dst;
+    UDOUBLE X_Max = (UDOUBLE)(W_Image - 1) << 16;
+    UDOUBLE Y_Max = (UDOUBLE)(H_Image - 1) << 16;
+    UDOUBLE Sx, Sy;
+    UWORD i, j;
+
+    if (Filter == SCALE_NEAREST)
+    {
+        Sy = Y_Step * Row_First + Y_Step / 2;
+        for (j = 0; j < Row_Count && yStart + j < Paint.Height; j++, Sy += Y_Step)
+        {
+            const unsigned char *pRow = image + (UDOUBLE)(Sy >> 16) * W_Image * 2;
+            Sx = X_Step / 2;
+            for (i = 0; i < W_Dst; i++, Sx += X_Step)
+            {
+                const unsigned char *p = pRow + (Sx >> 16) * 2;
+                Paint_Line[i] = p[1] << 8 | p[0];
+            }
+            Paint_DrawRow(xStart, yStart + j, W_Dst, Paint_Line);
+        }
+        return;
+    }
+
+    // Sample at pixel centers: (d + 0.5) * step - 0.5, clamped to the image
+    Sy = Y_Step * Row_First + Y_Step / 2;
+    for (j = 0; j < Row_Count && yStart + j < Paint.Height; j++, Sy += Y_Step)
+    {
+        UDOUBLE Sy_c = (Sy > 0x8000) ? Sy - 0x8000 : 0;
+        if (Sy_c > Y_Max)
+            Sy_c = Y_Max;
+        UWORD Y0 = Sy_c >> 16;
+        UWORD Y1 = (Y0 + 1 < H_Image) ? Y0 + 1 : Y0;
+        UWORD Wy = (Sy_c >> 11) & 0x1f;
+
+        Sx = X_Step / 2;
+        for (i = 0; i < W_Dst; i++, Sx += X_Step)
+        {
+            UDOUBLE Sx_c = (Sx > 0x8000) ? Sx - 0x8000 : 0;
+            if (Sx_c > X_Max)
+                Sx_c = X_Max;
+            UWORD X0 = Sx_c >> 16;
+            UWORD X1 = (X0 + 1 < W_Image) ? X0 + 1 : X0;
+            UWORD Wx = (Sx_c >> 11) & 0x1f;
+
+            uint32_t Top = Paint_Blend565(Paint_Spread565(Paint_ImagePixel(image, W_Image, X0, Y0)),
+                                          Paint_Spread565(Paint_ImagePixel(image, W_Image, X1, Y0)), Wx);
+            uint32_t Bottom = Paint_Blend565(Paint_Spread565(Paint_ImagePixel(image, W_Image, X0, Y1)),
+                                             Paint_Spread565(Paint_ImagePixel(image, W_Image, X1, Y1)), Wx);
+            uint32_t Mix = Paint_Blend565(Top, Bottom, Wy);
+            Paint_Line[i] = (Mix | (Mix >> 16)) & 0xffff;
+        }
+        Paint_DrawRow(xStart, yStart + j, W_Dst, Paint_Line);
+    }
+}
+
+/******************************************************************************
+function: Draw an RGB565 image scaled to a new size
+parameter:
+    image   : Source image, low byte first as in ImageData.c
+    W_Image : Source width
+    H_Image : Source height
+    xStart  : X coordinate
+    yStart  : Y coordinate
+    W_Dst   : Scaled width, at most PAINT_LINE_MAX
+    H_Dst   : Scaled height
+    Filter  : SCALE_NEAREST or SCALE_BILINEAR
+******************************************************************************/
+void Paint_DrawImageScaled(const unsigned char *image, UWORD W_Image, UWORD H_Image,
+                           UWORD xStart, UWORD yStart, UWORD W_Dst, UWORD H_Dst, SCALE_FILTER Filter)
+{
+    Paint_DrawImageScaledRows(image, W_Image, H_Image, xStart, yStart, W_Dst, H_Dst, 0, H_Dst, Filter);
+}
+
 /******************************************************************************
 function:	Display monochrome bitmap
 parameter:
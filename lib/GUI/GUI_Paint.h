@@ -22,6 +22,15 @@ typedef struct {
 } PAINT;
 extern PAINT Paint;
 
+/**
+ * Paint_SetScale value for 1 bit per pixel in vertical-byte pages, the RAM
+ * layout of the SH1106, SH1107 and SSD1305 OLED controllers. Byte
+ * X + (Y / 8) * WidthMemory holds column X of rows (Y & ~7)..(Y | 7), the
+ * top row in bit 0. Only the low byte of the color is looked at: a color
+ * whose low byte is 0 (BLACK) clears a bit, any other low byte sets it.
+**/
+#define PAINT_SCALE_PAGE    0x82
+
 /**
  * Display rotate
 **/
@@ -103,6 +112,72 @@ typedef enum {
     DRAW_FILL_FULL,
 } DRAW_FILL;
 
+/**
+ * Gradient direction
+**/
+typedef enum {
+    GRADIENT_HORIZONTAL = 0,
+    GRADIENT_VERTICAL,
+    GRADIENT_DIAGONAL,
+} GRADIENT_DIR;
+
+/**
+ * Image scaling filter
+**/
+typedef enum {
+    SCALE_NEAREST = 0,
+    SCALE_BILINEAR,
+} SCALE_FILTER;
+
+/**
+ * Longest line the fill helpers buffer, the largest supported panel side
+**/
+#define PAINT_LINE_MAX 320
+
+/**
+ * Progress ring, the angle is in 1/PAINT_RING_TURN of a turn
+**/
+#define PAINT_RING_TURN 1024
+
+typedef struct {
+    UWORD X_Center;
+    UWORD Y_Center;
+    UWORD Radius;       // outer radius
+    UWORD Thickness;
+    UWORD Color_Fill;   // color of the covered part
+    UWORD Color_Track;  // color of the rest of the ring
+    UWORD Max;          // value of a full ring
+    UWORD Angle;        // angle currently drawn, kept by Paint_DrawRing
+} PAINT_RING;
+
+/**
+ * Fonts a UTF-8 string is drawn with, any of them may be NULL
+**/
+typedef struct {
+    sFONT *Ascii;       // printable ASCII
+    pFONT *Prop;        // up to 0xFF, tried before Ascii
+    cFONT *Cjk;         // everything else
+} PAINT_FONT_SET;
+
+/**
+ * A glyph resolved from a UTF-8 string, Bitmap is NULL for a missing glyph
+**/
+typedef struct {
+    const unsigned char *Bitmap;
+    UWORD Code;         // code point, '\n' for a line break
+    UWORD Width;        // bitmap box
+    UWORD Height;
+    int16_t Advance;    // pen step, kerning included
+    int8_t X_Offset;    // box position from the pen and the line top
+    int8_t Y_Offset;
+    UBYTE Packed;       // rows not padded to a byte (pFONT)
+} PAINT_GLYPH;
+
+/**
+ * Characters Paint_DrawString_UTF8 decodes and looks up per batch
+**/
+#define PAINT_GLYPH_CHUNK 32
+
 /**
  * Custom structure of a time attribute
 **/
@@ -128,17 +203,45 @@ void Paint_Clear(UWORD Color);
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
 
 //Drawing
+void Paint_DrawSpan(UWORD Xpoint, UWORD Ypoint, UWORD Len, UWORD Color);
+void Paint_DrawRow(UWORD Xpoint, UWORD Ypoint, UWORD Len, const UWORD *Colors);
 void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay);
 void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
 void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
 void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void Paint_DrawRoundRect(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+
+//Progress ring
+void Paint_DrawRing(PAINT_RING *Ring, UWORD Value);
+void Paint_UpdateRing(PAINT_RING *Ring, UWORD Value);
+
+//Fill
+void Paint_FillLinearGradient(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color_Start, UWORD Color_End, GRADIENT_DIR Direction);
+void Paint_FillRadialGradient(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color_Center, UWORD Color_Edge);
+void Paint_FillPattern(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const unsigned char *pPattern, UWORD W_Tile, UWORD H_Tile, UWORD Color_Foreground, UWORD Color_Background);
 
 //Display string
 void Paint_DrawChar(UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawChar_Transparent(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground);
+void Paint_DrawString_EN_Transparent(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground);
+void Paint_DrawString_P(UWORD Xstart, UWORD Ystart, const char * pString, pFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawString_P_Transparent(UWORD Xstart, UWORD Ystart, const char * pString, pFONT* Font, UWORD Color_Foreground);
+UWORD Paint_StringWidth_P(const char * pString, pFONT* Font);
+void Paint_DrawChar_R(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, rFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawChar_R_Transparent(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, rFONT* Font, UWORD Color_Foreground);
+void Paint_DrawString_R(UWORD Xstart, UWORD Ystart, const char * pString, rFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawString_R_Transparent(UWORD Xstart, UWORD Ystart, const char * pString, rFONT* Font, UWORD Color_Foreground);
 void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawString_UTF8(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Ascii, cFONT* Cjk, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawString_UTF8_Transparent(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Ascii, cFONT* Cjk, UWORD Color_Foreground);
+UWORD Paint_ResolveString_UTF8(const char **ppString, PAINT_FONT_SET *Fonts, PAINT_GLYPH *Glyphs, UWORD Max);
+void Paint_DrawGlyph(UWORD Xpoint, UWORD Ypoint, const PAINT_GLYPH *Glyph, UWORD Line_Height, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawGlyph_Transparent(UWORD Xpoint, UWORD Ypoint, const PAINT_GLYPH *Glyph, UWORD Color_Foreground);
+UWORD Paint_LineHeight(PAINT_FONT_SET *Fonts);
 void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, double Nummber, sFONT* Font, UWORD Digit,UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawTime_P(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, pFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 
 //pic
 void Paint_DrawBitMap(const unsigned char* image_buffer);
@@ -146,6 +249,8 @@ void Paint_DrawBitMap_Block(const unsigned char* image_buffer, UBYTE Region);
 
 void Paint_DrawImage(const unsigned char *image, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image) ;
 void Paint_DrawImage1(const unsigned char *image, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image);
+void Paint_DrawImageScaled(const unsigned char *image, UWORD W_Image, UWORD H_Image, UWORD xStart, UWORD yStart, UWORD W_Dst, UWORD H_Dst, SCALE_FILTER Filter);
+void Paint_DrawImageScaledRows(const unsigned char *image, UWORD W_Image, UWORD H_Image, UWORD xStart, UWORD yStart, UWORD W_Dst, UWORD H_Dst, UWORD Row_First, UWORD Row_Count, SCALE_FILTER Filter);
  void Paint_BmpWindows(unsigned char x,unsigned char y,const unsigned char *pBmp,\
 					unsigned char chWidth,unsigned char chHeight);
 
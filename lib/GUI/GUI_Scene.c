@@ -0,0 +1,263 @@
+/*****************************************************************************
+* | File      	:   GUI_Scene.c
+* | Function    :   One scene shown on several displays
+* | Info        :
+*                Targets sample the scene nearest-neighbour, so a region can
+*                be shown smaller or larger than it is drawn. Only the rows
+*                (and for RGB565 the columns) of the dirty window are
+*                converted at a flush.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Scene.h"
+#include "GUI_Paint.h"
+#include "GUI_Dither.h"
+#include "Debug.h"
+#include <string.h> //memcpy()
+
+/**
+ * One row of a scaled target
+**/
+static UWORD Scene_Line[SCENE_LINE_MAX];
+
+/******************************************************************************
+function: Set up a scene
+parameter:
+    Scene  : Scene
+    Image  : Width * Height RGB565 pixels
+    Width  : Scene width
+    Height : Scene height
+******************************************************************************/
+void Scene_Init(SCENE *Scene, UWORD *Image, UWORD Width, UWORD Height)
+{
+    Scene->Image = Image;
+    Scene->Width = Width;
+    Scene->Height = Height;
+    Scene->Count = 0;
+}
+
+/******************************************************************************
+function: Add a display to a scene
+parameter:
+    Scene     : Scene
+    Target    : Target, kept by the scene
+    Format    : Pixel format of the display
+    Width     : Display resolution
+    Height    :
+    Source    : Scene region shown, ends exclusive, scaled to Width x Height
+    Buffer    : SCENE_BUFFER_SIZE(Format, Width, Height) bytes, may be NULL
+                for an RGB565 target showing whole scene rows at 1:1
+    Period_ms : Shortest time between two flushes, 0 for every service
+    Flush     : Sends the converted image to the display
+    User      : Left in Target->User for Flush
+info:
+    The whole target starts dirty. Returns 0 when the scene is full or the
+    arguments do not fit.
+******************************************************************************/
+UBYTE Scene_AddTarget(SCENE *Scene, SCENE_TARGET *Target, SCENE_FORMAT Format, UWORD Width, UWORD Height,
+                      const SCENE_RECT *Source, UBYTE *Buffer, UDOUBLE Period_ms, SCENE_FLUSH Flush, void *User)
+{
+    if (Scene->Count >= SCENE_TARGETS)
+    {
+        Debug("Scene_AddTarget Too many targets\r\n");
+        return 0;
+    }
+    if (Width == 0 || Height == 0 || Width > SCENE_LINE_MAX ||
+        Source->Xstart >= Source->Xend || Source->Ystart >= Source->Yend ||
+        Source->Xend > Scene->Width || Source->Yend > Scene->Height)
+    {
+        Debug("Scene_AddTarget Target exceeds the scene\r\n");
+        return 0;
+    }
+
+    Target->Format = Format;
+    Target->Width = Width;
+    Target->Height = Height;
+    Target->Source = *Source;
+    Target->Direct = (Format == SCENE_RGB565 && Source->Xstart == 0 && Width == Scene->Width &&
+                      Source->Xend == Width && Source->Yend - Source->Ystart == Height);
+    if (Target->Direct && Buffer == NULL)
+        Buffer = (UBYTE *)&Scene->Image[(UDOUBLE)Source->Ystart * Scene->Width];
+    else
+        Target->Direct = 0;
+    if (Buffer == NULL)
+    {
+        Debug("Scene_AddTarget Target needs a buffer\r\n");
+        return 0;
+    }
+    Target->Buffer = Buffer;
+    Target->Period_ms = Period_ms;
+    Target->Last_ms = 0 - Period_ms; // flushed one period ago, the first flush is not held back
+    Target->Dirty.Xstart = 0;
+    Target->Dirty.Ystart = 0;
+    Target->Dirty.Xend = Width;
+    Target->Dirty.Yend = Height;
+    Target->Flush = Flush;
+    Target->User = User;
+
+    Scene->Targets[Scene->Count++] = Target;
+    return 1;
+}
+
+/******************************************************************************
+function: Make the scene the Paint image
+info:
+    Scale 65, not rotated. Draw, then Scene_Invalidate what was drawn.
+******************************************************************************/
+void Scene_Select(SCENE *Scene)
+{
+    Paint_NewImage((UBYTE *)Scene->Image, Scene->Width, Scene->Height, ROTATE_0, WHITE);
+    Paint_SetScale(65);
+}
+
+/******************************************************************************
+function: First target pixel sampling scene offset Pos or later
+info:
+    Target pixel X samples scene offset X * Src_Len / Dst_Len, rounded down.
+******************************************************************************/
+static UWORD Scene_Map(UWORD Pos, UWORD Src_Len, UWORD Dst_Len)
+{
+    return ((UDOUBLE)Pos * Dst_Len + Src_Len - 1) / Src_Len;
+}
+
+/******************************************************************************
+function: Mark a scene window as changed
+parameter:
+    Scene : Scene
+    Xstart, Ystart, Xend, Yend : Window, ends exclusive
+info:
+    Each target whose region overlaps it adds the target pixels that sample
+    the window to its dirty window.
+******************************************************************************/
+void Scene_Invalidate(SCENE *Scene, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    UBYTE i;
+
+    for (i = 0; i < Scene->Count; i++)
+    {
+        SCENE_TARGET *Target = Scene->Targets[i];
+        const SCENE_RECT *Src = &Target->Source;
+        UWORD Src_Width = Src->Xend - Src->Xstart;
+        UWORD Src_Height = Src->Yend - Src->Ystart;
+        UWORD X0 = (Xstart > Src->Xstart) ? Xstart : Src->Xstart;
+        UWORD Y0 = (Ystart > Src->Ystart) ? Ystart : Src->Ystart;
+        UWORD X1 = (Xend < Src->Xend) ? Xend : Src->Xend;
+        UWORD Y1 = (Yend < Src->Yend) ? Yend : Src->Yend;
+
+        if (X0 >= X1 || Y0 >= Y1)
+            continue;
+        X0 = Scene_Map(X0 - Src->Xstart, Src_Width, Target->Width);
+        X1 = Scene_Map(X1 - Src->Xstart, Src_Width, Target->Width);
+        Y0 = Scene_Map(Y0 - Src->Ystart, Src_Height, Target->Height);
+        Y1 = Scene_Map(Y1 - Src->Ystart, Src_Height, Target->Height);
+        if (X0 >= X1 || Y0 >= Y1)
+            continue; // no target pixel samples it
+
+        SCENE_RECT *Dirty = &Target->Dirty;
+        if (Dirty->Xstart >= Dirty->Xend)
+        {
+            Dirty->Xstart = X0;
+            Dirty->Ystart = Y0;
+            Dirty->Xend = X1;
+            Dirty->Yend = Y1;
+            continue;
+        }
+        if (X0 < Dirty->Xstart)
+            Dirty->Xstart = X0;
+        if (Y0 < Dirty->Ystart)
+            Dirty->Ystart = Y0;
+        if (X1 > Dirty->Xend)
+            Dirty->Xend = X1;
+        if (Y1 > Dirty->Yend)
+            Dirty->Yend = Y1;
+    }
+}
+
+/******************************************************************************
+function: Convert the dirty window of a target into its buffer
+info:
+    Monochrome rows are converted whole, the dither pattern and the packed
+    bytes both follow the row.
+******************************************************************************/
+static void Scene_Convert(SCENE *Scene, SCENE_TARGET *Target, const SCENE_RECT *Dirty)
+{
+    const SCENE_RECT *Src = &Target->Source;
+    UWORD Src_Width = Src->Xend - Src->Xstart;
+    UWORD Src_Height = Src->Yend - Src->Ystart;
+    UWORD Xstart = Dirty->Xstart, Xend = Dirty->Xend;
+    UWORD X, Y;
+
+    if (Target->Format == SCENE_MONO)
+    {
+        Xstart = 0;
+        Xend = Target->Width;
+    }
+
+    for (Y = Dirty->Ystart; Y < Dirty->Yend; Y++)
+    {
+        UDOUBLE Src_Y = Src->Ystart + (UDOUBLE)Y * Src_Height / Target->Height;
+        const UWORD *pRow = &Scene->Image[Src_Y * Scene->Width + Src->Xstart];
+        const UWORD *pSrc = pRow + Xstart;
+
+        if (Src_Width != Target->Width)
+        {
+            for (X = Xstart; X < Xend; X++)
+                Scene_Line[X - Xstart] = pRow[(UDOUBLE)X * Src_Width / Target->Width];
+            pSrc = Scene_Line;
+        }
+
+        if (Target->Format == SCENE_RGB565)
+            memcpy(Target->Buffer + ((UDOUBLE)Y * Target->Width + Xstart) * 2, pSrc, (Xend - Xstart) * 2);
+        else
+            Dither_OrderedRow((const UBYTE *)pSrc, DITHER_SRC_LE, Target->Width, Y,
+                              Target->Buffer + (UDOUBLE)Y * ((Target->Width + 7) / 8), 2);
+    }
+}
+
+/******************************************************************************
+function: Convert and send what changed on a target now
+parameter:
+    Scene  : Scene
+    Target : One of its targets
+******************************************************************************/
+void Scene_Flush(SCENE *Scene, SCENE_TARGET *Target)
+{
+    SCENE_RECT Dirty = Target->Dirty;
+
+    if (Dirty.Xstart >= Dirty.Xend)
+        return;
+    Target->Dirty.Xstart = Target->Dirty.Xend = 0;
+
+    if (!Target->Direct)
+        Scene_Convert(Scene, Target, &Dirty);
+    if (Target->Flush)
+        Target->Flush(Target, &Dirty);
+}
+
+/******************************************************************************
+function: Flush every target that changed and whose period has passed
+parameter:
+    Scene  : Scene
+    Now_ms : Current time, e.g. to_ms_since_boot(get_absolute_time())
+info:
+    Returns the number of targets flushed.
+******************************************************************************/
+UBYTE Scene_Service(SCENE *Scene, UDOUBLE Now_ms)
+{
+    UBYTE i, Count = 0;
+
+    for (i = 0; i < Scene->Count; i++)
+    {
+        SCENE_TARGET *Target = Scene->Targets[i];
+
+        if (Target->Dirty.Xstart >= Target->Dirty.Xend || Now_ms - Target->Last_ms < Target->Period_ms)
+            continue;
+        Scene_Flush(Scene, Target);
+        Target->Last_ms = Now_ms;
+        Count++;
+    }
+    return Count;
+}
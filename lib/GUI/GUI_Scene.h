@@ -0,0 +1,98 @@
+/*****************************************************************************
+* | File      	:   GUI_Scene.h
+* | Function    :   One scene shown on several displays
+* | Info        :
+*                The scene is an RGB565 image drawn once with Paint. Each
+*                target shows a region of it at its own resolution and in
+*                its own pixel format, converted when the target is flushed.
+*                Targets keep their own dirty window and refresh period, so
+*                a colour LCD and a monochrome OLED update independently.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_SCENE_H
+#define __GUI_SCENE_H
+
+#include "DEV_Config.h"
+
+/**
+ * Targets a scene drives
+**/
+#define SCENE_TARGETS   4
+
+/**
+ * Widest target, the length of the conversion row buffer
+**/
+#define SCENE_LINE_MAX  320
+
+/**
+ * Pixel format of a target
+**/
+typedef enum {
+    SCENE_RGB565 = 0,   // native RGB565 words, as Paint at Scale 65
+    SCENE_MONO,         // 1 bit per pixel rows, as Paint at Scale 2, ordered dither
+} SCENE_FORMAT;
+
+/**
+ * Buffer bytes of a target
+**/
+#define SCENE_BUFFER_SIZE(Format, Width, Height) \
+    ((Format) == SCENE_RGB565 ? (UDOUBLE)(Width) * (Height) * 2 : (UDOUBLE)(((Width) + 7) / 8) * (Height))
+
+/**
+ * Window, ends exclusive, empty when Xstart >= Xend
+**/
+typedef struct {
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Xend;
+    UWORD Yend;
+} SCENE_RECT;
+
+typedef struct SCENE_TARGET SCENE_TARGET;
+
+/**
+ * Sends the Dirty window of Target->Buffer, in target pixels, to the display
+**/
+typedef void (*SCENE_FLUSH)(SCENE_TARGET *Target, const SCENE_RECT *Dirty);
+
+/**
+ * A display fed by the scene
+**/
+struct SCENE_TARGET {
+    SCENE_FORMAT Format;
+    UWORD Width;            // display resolution
+    UWORD Height;
+    SCENE_RECT Source;      // scene region, scaled to Width x Height
+    UBYTE *Buffer;          // image in Format, rows inside the scene when Direct
+    UBYTE Direct;           // RGB565 full scene rows at 1:1, no conversion
+    UDOUBLE Period_ms;      // shortest time between two flushes
+    UDOUBLE Last_ms;        // time of the last flush
+    SCENE_RECT Dirty;       // target pixels changed since the last flush
+    SCENE_FLUSH Flush;
+    void *User;             // for Flush, usually the driver
+};
+
+/**
+ * The scene and its targets
+**/
+typedef struct {
+    UWORD *Image;           // Width x Height RGB565
+    UWORD Width;
+    UWORD Height;
+    SCENE_TARGET *Targets[SCENE_TARGETS];
+    UBYTE Count;
+} SCENE;
+
+void Scene_Init(SCENE *Scene, UWORD *Image, UWORD Width, UWORD Height);
+UBYTE Scene_AddTarget(SCENE *Scene, SCENE_TARGET *Target, SCENE_FORMAT Format, UWORD Width, UWORD Height,
+                      const SCENE_RECT *Source, UBYTE *Buffer, UDOUBLE Period_ms, SCENE_FLUSH Flush, void *User);
+void Scene_Select(SCENE *Scene);
+void Scene_Invalidate(SCENE *Scene, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void Scene_Flush(SCENE *Scene, SCENE_TARGET *Target);
+UBYTE Scene_Service(SCENE *Scene, UDOUBLE Now_ms);
+
+#endif
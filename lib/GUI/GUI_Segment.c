@@ -0,0 +1,221 @@
+/*****************************************************************************
+* | File      	:   GUI_Segment.c
+* | Function    :   Large seven-segment digits
+* | Info        :
+*                Each segment row is one Paint_DrawSpan. Updates compare the
+*                new cell masks with the ones on screen and touch only the
+*                segments that differ.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Segment.h"
+#include "Debug.h"
+
+/**
+ * Segments lit for 0 .. 9 and A .. F, bit 0 is a
+**/
+static const UBYTE Segment_Hex[16] = {
+    0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x07,
+    0x7f, 0x6f, 0x77, 0x7c, 0x39, 0x5e, 0x79, 0x71,
+};
+
+/******************************************************************************
+function: Cell mask of a character
+info:
+    0-9, A-F and a-f are digits, '-' lights g, ' ' is an empty digit.
+    ':' is a colon cell, ';' a colon cell with the dots off so a colon can
+    blink without moving the cells after it.
+******************************************************************************/
+static UWORD Segment_Mask(char Char)
+{
+    if (Char >= '0' && Char <= '9')
+        return Segment_Hex[Char - '0'];
+    if (Char >= 'A' && Char <= 'F')
+        return Segment_Hex[Char - 'A' + 10];
+    if (Char >= 'a' && Char <= 'f')
+        return Segment_Hex[Char - 'a' + 10];
+    if (Char == '-')
+        return 0x40;
+    if (Char == ':')
+        return SEGMENT_COLON | SEGMENT_DOTS;
+    if (Char == ';')
+        return SEGMENT_COLON;
+    if (Char != ' ')
+    {
+        Debug("Segment_Mask Unsupported character, drawn as a space\r\n");
+    }
+    return 0;
+}
+
+/******************************************************************************
+function: Width of a cell
+******************************************************************************/
+static inline UWORD Segment_CellWidth(const SEGMENT_FONT *Font, UWORD Mask)
+{
+    return (Mask & SEGMENT_COLON) ? Font->Thickness : Font->Width;
+}
+
+/******************************************************************************
+function: Fill one segment of a cell
+info:
+    With Bevel set, rows within half a thickness of either end of a .. g are
+    inset so the segment ends in a point.
+******************************************************************************/
+static void Segment_Fill(const SEGMENT_FONT *Font, UWORD Xpoint, UWORD Ypoint,
+                         UBYTE Index, UWORD Color)
+{
+    const SEGMENT_RECT *Rect = &Font->Segment[Index];
+    UWORD Half = (Font->Thickness - 1) / 2;
+    UWORD Row, End, Inset;
+
+    Xpoint += Rect->X;
+    Ypoint += Rect->Y;
+    if (Xpoint >= Paint.Width)
+        return;
+
+    for (Row = 0; Row < Rect->Height && Ypoint + Row < Paint.Height; Row++)
+    {
+        Inset = 0;
+        if (Font->Bevel && Index < SEGMENT_DIGIT_COUNT)
+        {
+            End = (Row < Rect->Height - 1 - Row) ? Row : Rect->Height - 1 - Row;
+            if (End < Half)
+                Inset = Half - End;
+        }
+        if (Rect->Width > 2 * Inset && Xpoint + Inset < Paint.Width)
+            Paint_DrawSpan(Xpoint + Inset, Ypoint + Row, Rect->Width - 2 * Inset, Color);
+    }
+}
+
+/******************************************************************************
+function: Fill the box of a row of cells with the background
+******************************************************************************/
+static void Segment_Clear(SEGMENT_DISPLAY *Display, const UWORD *Mask, UBYTE Count)
+{
+    UWORD Width = 0, Row;
+    UBYTE i;
+
+    for (i = 0; i < Count; i++)
+        Width += Segment_CellWidth(Display->Font, Mask[i]) + (i ? Display->Spacing : 0);
+    if (Width == 0 || Display->Xstart >= Paint.Width)
+        return;
+
+    for (Row = 0; Row < Display->Font->Height && Display->Ystart + Row < Paint.Height; Row++)
+        Paint_DrawSpan(Display->Xstart, Display->Ystart + Row, Width, Display->Color_Background);
+}
+
+/******************************************************************************
+function: Set up a display
+parameter:
+    Display : Display to set up
+    Font    : Digit geometry, usually a SEGMENT_FONT_INIT constant
+    Xstart  : Top left corner of the first cell
+    Ystart  :
+    Spacing : Pixels between cells
+    Color_On         : Lit segments
+    Color_Off        : Unlit segments
+    Color_Background : Everything else
+info:
+    Nothing is drawn until the first Segment_Update.
+******************************************************************************/
+void Segment_NewDisplay(SEGMENT_DISPLAY *Display, const SEGMENT_FONT *Font,
+                        UWORD Xstart, UWORD Ystart, UWORD Spacing,
+                        UWORD Color_On, UWORD Color_Off, UWORD Color_Background)
+{
+    Display->Font = Font;
+    Display->Xstart = Xstart;
+    Display->Ystart = Ystart;
+    Display->Spacing = Spacing;
+    Display->Color_On = Color_On;
+    Display->Color_Off = Color_Off;
+    Display->Color_Background = Color_Background;
+    Display->Count = 0;
+    Display->Valid = 0;
+}
+
+/******************************************************************************
+function: Width in pixels of a string drawn by Segment_Update
+******************************************************************************/
+UWORD Segment_Width(const SEGMENT_FONT *Font, const char *pString, UWORD Spacing)
+{
+    UWORD Width = 0;
+    UBYTE i;
+
+    for (i = 0; pString[i] != '\0' && i < SEGMENT_CELLS_MAX; i++)
+        Width += Segment_CellWidth(Font, Segment_Mask(pString[i])) + (i ? Spacing : 0);
+    return Width;
+}
+
+/******************************************************************************
+function: Show a string
+parameter:
+    Display : Display set up by Segment_NewDisplay
+    pString : Digits, '-', ' ', ':' and ';', at most SEGMENT_CELLS_MAX
+info:
+    When the cells keep their kinds (digit or colon) only the segments that
+    toggled are drawn, otherwise the row is cleared and drawn again.
+    Returns the number of segments drawn, 0 when the image is unchanged.
+******************************************************************************/
+UWORD Segment_Update(SEGMENT_DISPLAY *Display, const char *pString)
+{
+    const SEGMENT_FONT *Font = Display->Font;
+    UWORD Mask[SEGMENT_CELLS_MAX] = {0};
+    UWORD Xpoint = Display->Xstart;
+    UWORD Drawn = 0, Diff, Color;
+    UBYTE Count, Full, i, Index;
+
+    for (Count = 0; pString[Count] != '\0' && Count < SEGMENT_CELLS_MAX; Count++)
+        Mask[Count] = Segment_Mask(pString[Count]);
+    if (pString[Count] != '\0')
+    {
+        Debug("Segment_Update String longer than SEGMENT_CELLS_MAX, cut\r\n");
+    }
+
+    Full = !Display->Valid || Count != Display->Count;
+    for (i = 0; i < Count && !Full; i++)
+    {
+        if ((Mask[i] ^ Display->Mask[i]) & SEGMENT_COLON)
+            Full = 1;
+    }
+    if (Full)
+    {
+        if (Display->Valid)
+            Segment_Clear(Display, Display->Mask, Display->Count);
+        Segment_Clear(Display, Mask, Count);
+    }
+
+    for (i = 0; i < Count; i++)
+    {
+        // After a clear every unlit segment still needs Color_Off
+        Diff = Full ? ((Display->Color_Off != Display->Color_Background) ? 0x1ff : Mask[i])
+                    : Mask[i] ^ Display->Mask[i];
+        Diff &= (Mask[i] & SEGMENT_COLON) ? SEGMENT_DOTS : 0x7f;
+
+        for (Index = 0; Diff != 0; Index++, Diff >>= 1)
+        {
+            if ((Diff & 1) == 0)
+                continue;
+            Color = ((Mask[i] >> Index) & 1) ? Display->Color_On : Display->Color_Off;
+            Segment_Fill(Font, Xpoint, Display->Ystart, Index, Color);
+            Drawn++;
+        }
+        Xpoint += Segment_CellWidth(Font, Mask[i]) + Display->Spacing;
+        Display->Mask[i] = Mask[i];
+    }
+    Display->Count = Count;
+    Display->Valid = 1;
+    return Drawn;
+}
+
+/******************************************************************************
+function: Forget what the display shows, the next update draws it all
+info:
+    Call after something else has drawn over the display area.
+******************************************************************************/
+void Segment_Invalidate(SEGMENT_DISPLAY *Display)
+{
+    Display->Valid = 0;
+}
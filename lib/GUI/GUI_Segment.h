@@ -0,0 +1,111 @@
+/*****************************************************************************
+* | File      	:   GUI_Segment.h
+* | Function    :   Large seven-segment digits
+* | Info        :
+*                Digits are built from a handful of segment boxes whose
+*                geometry is worked out by the compiler for the chosen size,
+*                so a big readout costs a few spans per segment instead of a
+*                glyph blit. A display remembers what it shows and redraws
+*                only the segments that toggled.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_SEGMENT_H
+#define __GUI_SEGMENT_H
+
+#include "GUI_Paint.h"
+
+/**
+ * Segment order: a (top), b, c, d, e, f clockwise, g (middle), then the
+ * two dots of a colon cell
+**/
+#define SEGMENT_DIGIT_COUNT 7
+#define SEGMENT_COUNT       9
+
+/**
+ * Cell flag and colon dots in a cell mask, segments a .. g are bits 0 .. 6
+**/
+#define SEGMENT_DOTS        0x0180
+#define SEGMENT_COLON       0x8000
+
+/**
+ * Most cells a display holds
+**/
+#define SEGMENT_CELLS_MAX   12
+
+/**
+ * Pixels left between neighbouring segments
+**/
+#define SEGMENT_GAP         1
+
+/**
+ * Box of one segment inside the digit cell
+**/
+typedef struct {
+    UWORD X;
+    UWORD Y;
+    UWORD Width;
+    UWORD Height;
+} SEGMENT_RECT;
+
+/**
+ * Digit geometry. Bevel cuts the ends of a .. g to points. A custom style
+ * is a table with other boxes, e.g. SEGMENT_FONT_INIT with Bevel cleared.
+**/
+typedef struct {
+    UWORD Width;        // digit cell
+    UWORD Height;
+    UWORD Thickness;    // segment thickness, also the colon cell width
+    UBYTE Bevel;
+    SEGMENT_RECT Segment[SEGMENT_COUNT];
+} SEGMENT_FONT;
+
+#define SEGMENT_END(T)              ((T) / 2 + SEGMENT_GAP)
+#define SEGMENT_ROW(W, T, Y)        {SEGMENT_END(T), (Y), (W) - 2 * SEGMENT_END(T), (T)}
+#define SEGMENT_UPPER(X, H, T)      {(X), SEGMENT_END(T), (T), (H) / 2 - SEGMENT_END(T) - SEGMENT_GAP}
+#define SEGMENT_LOWER(X, H, T)      {(X), (H) / 2 + SEGMENT_GAP, (T), (H) - (H) / 2 - SEGMENT_END(T) - SEGMENT_GAP}
+
+/**
+ * Constant initializer of a SEGMENT_FONT, W x H cell, segments T thick
+**/
+#define SEGMENT_FONT_INIT(W, H, T, Bevel) {                     \
+    (W), (H), (T), (Bevel), {                                   \
+        SEGMENT_ROW(W, T, 0),                   /* a */         \
+        SEGMENT_UPPER((W) - (T), H, T),         /* b */         \
+        SEGMENT_LOWER((W) - (T), H, T),         /* c */         \
+        SEGMENT_ROW(W, T, (H) - (T)),           /* d */         \
+        SEGMENT_LOWER(0, H, T),                 /* e */         \
+        SEGMENT_UPPER(0, H, T),                 /* f */         \
+        SEGMENT_ROW(W, T, (H) / 2 - (T) / 2),   /* g */         \
+        {0, (H) / 3 - (T) / 2, (T), (T)},       /* upper dot */ \
+        {0, (H) * 2 / 3 - (T) / 2, (T), (T)},   /* lower dot */ \
+    }                                                           \
+}
+
+/**
+ * A row of digit and colon cells on the current image
+**/
+typedef struct {
+    const SEGMENT_FONT *Font;
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Spacing;          // pixels between cells
+    UWORD Color_On;
+    UWORD Color_Off;        // unlit segments, Color_Background to hide them
+    UWORD Color_Background;
+    UBYTE Count;            // cells shown
+    UBYTE Valid;            // Mask describes the image
+    UWORD Mask[SEGMENT_CELLS_MAX];
+} SEGMENT_DISPLAY;
+
+void Segment_NewDisplay(SEGMENT_DISPLAY *Display, const SEGMENT_FONT *Font,
+                        UWORD Xstart, UWORD Ystart, UWORD Spacing,
+                        UWORD Color_On, UWORD Color_Off, UWORD Color_Background);
+UWORD Segment_Width(const SEGMENT_FONT *Font, const char *pString, UWORD Spacing);
+UWORD Segment_Update(SEGMENT_DISPLAY *Display, const char *pString);
+void Segment_Invalidate(SEGMENT_DISPLAY *Display);
+
+#endif
@@ -0,0 +1,367 @@
+/*****************************************************************************
+* | File      	:   GUI_Text.c
+* | Function    :   Text measurement and layout in a box
+* | Info        :
+*                Lines break after a space, before a CJK character, or inside
+*                a word longer than the box. Spaces are not kept as runs, so
+*                Text_Draw only visits glyphs with ink.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Text.h"
+#include "Debug.h"
+#include <string.h> //strlen() memcmp()
+
+#define TEXT_ELLIPSIS       "..."
+#define TEXT_ELLIPSIS_LEN   3
+
+/**
+ * Line breaking state while a string is laid out
+**/
+typedef struct {
+    TEXT_LAYOUT *Layout;
+    PAINT_FONT_SET *Fonts;
+    TEXT_ALIGN Align;
+    UWORD Start;        // first run of the current line
+    UWORD Break;        // run the line may be broken before, Start for none
+    int Pen;            // pen position in the current line
+    UBYTE Wrapped;      // current line was started by a wrap
+    UBYTE Done;
+} TEXT_STATE;
+
+/******************************************************************************
+function: Whether a line may break before the character
+info:
+    CJK text has no spaces, any of its characters may start a line.
+******************************************************************************/
+static inline UBYTE Text_BreaksBefore(UWORD Code)
+{
+    return Code >= 0x2e80;
+}
+
+/******************************************************************************
+function: Width of the runs Start .. End - 1 of a line
+******************************************************************************/
+static int Text_RunsWidth(const TEXT_LAYOUT *Layout, UWORD Start, UWORD End)
+{
+    if (End == Start)
+        return 0;
+    return Layout->Runs[End - 1].X + Layout->Runs[End - 1].Glyph.Advance;
+}
+
+/******************************************************************************
+function: Align the runs Start .. End - 1 and move them to the next line
+******************************************************************************/
+static void Text_PlaceLine(TEXT_STATE *State, UWORD End)
+{
+    TEXT_LAYOUT *Layout = State->Layout;
+    int Offset = Layout->Box_Width - Text_RunsWidth(Layout, State->Start, End);
+    UWORD i;
+
+    if (State->Align == TEXT_ALIGN_LEFT || Offset < 0)
+        Offset = 0;
+    else if (State->Align == TEXT_ALIGN_CENTER)
+        Offset /= 2;
+
+    for (i = State->Start; i < End; i++)
+    {
+        Layout->Runs[i].X += Offset;
+        Layout->Runs[i].Y = Layout->Lines * Layout->Line_Height;
+    }
+    Layout->Lines++;
+}
+
+/******************************************************************************
+function: End the layout on the current line with an ellipsis
+parameter:
+    State : Layout state
+    End   : Runs of the current line kept at most
+info:
+    Glyphs are dropped from the end of the line until the ellipsis fits in
+    both the box and the run list.
+******************************************************************************/
+static void Text_Ellipsis(TEXT_STATE *State, UWORD End)
+{
+    TEXT_LAYOUT *Layout = State->Layout;
+    PAINT_GLYPH Dots[TEXT_ELLIPSIS_LEN];
+    const char *pDots = TEXT_ELLIPSIS;
+    UWORD Count = Paint_ResolveString_UTF8(&pDots, State->Fonts, Dots, TEXT_ELLIPSIS_LEN);
+    int Dots_Width = 0, Pen;
+    UWORD i;
+
+    for (i = 0; i < Count; i++)
+        Dots_Width += Dots[i].Advance;
+
+    while (End > State->Start
+           && (End + Count > Layout->Max
+               || Text_RunsWidth(Layout, State->Start, End) + Dots_Width > Layout->Box_Width))
+        End--;
+
+    Pen = Text_RunsWidth(Layout, State->Start, End);
+    for (i = 0; i < Count && End < Layout->Max && Pen + Dots[i].Advance <= Layout->Box_Width; i++)
+    {
+        Layout->Runs[End].Glyph = Dots[i];
+        Layout->Runs[End].X = Pen;
+        Pen += Dots[i].Advance;
+        End++;
+    }
+
+    Text_PlaceLine(State, End);
+    Layout->Count = End;
+    Layout->Truncated = 1;
+    State->Done = 1;
+}
+
+/******************************************************************************
+function: End the current line before run End
+info:
+    The runs End .. Count - 1 start the next line. When the box has no room
+    for another line the layout ends here with an ellipsis.
+******************************************************************************/
+static void Text_NewLine(TEXT_STATE *State, UWORD End)
+{
+    TEXT_LAYOUT *Layout = State->Layout;
+    int Shift;
+    UWORD i;
+
+    if ((Layout->Lines + 2) * Layout->Line_Height > Layout->Box_Height)
+    {
+        Text_Ellipsis(State, End);
+        return;
+    }
+    Text_PlaceLine(State, End);
+
+    Shift = (End < Layout->Count) ? Layout->Runs[End].X : State->Pen;
+    for (i = End; i < Layout->Count; i++)
+        Layout->Runs[i].X -= Shift;
+    State->Pen -= Shift;
+    State->Start = State->Break = End;
+}
+
+/******************************************************************************
+function: Add one glyph to the layout
+******************************************************************************/
+static void Text_Feed(TEXT_STATE *State, const PAINT_GLYPH *Glyph)
+{
+    TEXT_LAYOUT *Layout = State->Layout;
+    TEXT_RUN *Run;
+
+    if (Glyph->Code == '\n')
+    {
+        State->Pen = 0;
+        Text_NewLine(State, Layout->Count);
+        State->Wrapped = 0;
+        return;
+    }
+
+    if (Glyph->Code == ' ')
+    {
+        // Spaces that a wrap moved to the start of a line are dropped
+        if (State->Wrapped && Layout->Count == State->Start)
+            return;
+        State->Break = Layout->Count;
+        State->Pen += Glyph->Advance;
+        return;
+    }
+
+    if (Text_BreaksBefore(Glyph->Code))
+        State->Break = Layout->Count;
+
+    if (State->Pen + Glyph->Advance > Layout->Box_Width && Layout->Count > State->Start)
+    {
+        // Break at the last opportunity, or inside a word that fills the line
+        Text_NewLine(State, State->Break > State->Start ? State->Break : Layout->Count);
+        if (State->Done)
+            return;
+        State->Wrapped = 1;
+    }
+
+    if (Layout->Count == Layout->Max)
+    {
+        Text_Ellipsis(State, Layout->Count);
+        return;
+    }
+
+    Run = &Layout->Runs[Layout->Count++];
+    Run->Glyph = *Glyph;
+    Run->X = State->Pen;
+    Run->Y = 0;
+    State->Pen += Glyph->Advance;
+    State->Wrapped = 0;
+}
+
+/******************************************************************************
+function: Bind a layout to its run list
+parameter:
+    Layout : Layout to set up
+    Runs   : Run list, Max entries
+    Max    : Room for glyphs, spaces excluded
+******************************************************************************/
+void Text_NewLayout(TEXT_LAYOUT *Layout, TEXT_RUN *Runs, UWORD Max)
+{
+    Layout->Runs = Runs;
+    Layout->Max = Max;
+    Layout->Count = 0;
+    Layout->Box_Width = 0;
+    Layout->Box_Height = 0;
+    Layout->Line_Height = 0;
+    Layout->Lines = 0;
+    Layout->Truncated = 0;
+    Layout->Align = TEXT_ALIGN_LEFT;
+    memset(&Layout->Fonts, 0, sizeof(PAINT_FONT_SET));
+    Layout->Valid = 0;
+    Layout->Text[0] = '\0';
+}
+
+/******************************************************************************
+function: Width of the widest line of a string, without wrapping
+parameter:
+    pString : UTF-8 string
+    Fonts   : Fonts the string is drawn with
+******************************************************************************/
+UWORD Text_Measure(const char *pString, PAINT_FONT_SET *Fonts)
+{
+    PAINT_GLYPH Glyphs[PAINT_GLYPH_CHUNK];
+    int Width = 0, Widest = 0;
+    UWORD Count, i;
+
+    while (*pString != '\0')
+    {
+        Count = Paint_ResolveString_UTF8(&pString, Fonts, Glyphs, PAINT_GLYPH_CHUNK);
+        for (i = 0; i < Count; i++)
+        {
+            if (Glyphs[i].Code == '\n')
+                Width = 0;
+            else
+                Width += Glyphs[i].Advance;
+            if (Width > Widest)
+                Widest = Width;
+        }
+    }
+    return Widest;
+}
+
+/******************************************************************************
+function: Lay out a string in a box
+parameter:
+    Layout     : Layout set up by Text_NewLayout
+    pString    : UTF-8 string
+    Fonts      : Fonts the string is drawn with
+    Box_Width  : Box size in pixels
+    Box_Height :
+    Align      : Alignment of each line
+info:
+    Returns 0 and leaves the runs alone when the string and parameters are
+    the ones the layout already holds, so a caller refreshing a label can
+    call it every frame and redraw only on 1. The layout keeps a copy of
+    strings shorter than TEXT_CACHE_MAX bytes to compare against. Text that
+    does not fit ends with an ellipsis and sets Truncated.
+******************************************************************************/
+UBYTE Text_Layout(TEXT_LAYOUT *Layout, const char *pString, PAINT_FONT_SET *Fonts,
+                  UWORD Box_Width, UWORD Box_Height, TEXT_ALIGN Align)
+{
+    PAINT_GLYPH Glyphs[PAINT_GLYPH_CHUNK];
+    TEXT_STATE State;
+    UDOUBLE Len = strlen(pString);
+    UWORD Count, i;
+
+    if (Layout->Valid && Layout->Box_Width == Box_Width && Layout->Box_Height == Box_Height &&
+        Layout->Align == Align && memcmp(&Layout->Fonts, Fonts, sizeof(PAINT_FONT_SET)) == 0 &&
+        strcmp(Layout->Text, pString) == 0)
+        return 0;
+
+    Layout->Count = 0;
+    Layout->Lines = 0;
+    Layout->Truncated = 0;
+    Layout->Box_Width = Box_Width;
+    Layout->Box_Height = Box_Height;
+    Layout->Line_Height = Paint_LineHeight(Fonts);
+    Layout->Align = Align;
+    Layout->Fonts = *Fonts;
+    Layout->Valid = Len < TEXT_CACHE_MAX;
+    if (Layout->Valid)
+        memcpy(Layout->Text, pString, Len + 1);
+    if (Layout->Line_Height == 0 || Layout->Line_Height > Box_Height)
+    {
+        Debug("Text_Layout No line fits the box\r\n");
+        return 1;
+    }
+
+    State.Layout = Layout;
+    State.Fonts = Fonts;
+    State.Align = Align;
+    State.Start = State.Break = 0;
+    State.Pen = 0;
+    State.Wrapped = 0;
+    State.Done = 0;
+
+    while (!State.Done && *pString != '\0')
+    {
+        Count = Paint_ResolveString_UTF8(&pString, Fonts, Glyphs, PAINT_GLYPH_CHUNK);
+        for (i = 0; i < Count && !State.Done; i++)
+            Text_Feed(&State, &Glyphs[i]);
+    }
+    if (!State.Done)
+        Text_PlaceLine(&State, Layout->Count);
+    return 1;
+}
+
+/******************************************************************************
+function: Draw the glyphs of a laid out string
+******************************************************************************/
+static void Text_DrawRuns(const TEXT_LAYOUT *Layout, UWORD Xstart, UWORD Ystart, UWORD Color_Foreground)
+{
+    UWORD i;
+
+    for (i = 0; i < Layout->Count; i++)
+    {
+        const TEXT_RUN *Run = &Layout->Runs[i];
+        Paint_DrawGlyph_Transparent(Xstart + Run->X, Ystart + Run->Y, &Run->Glyph, Color_Foreground);
+    }
+}
+
+/******************************************************************************
+function: Draw a laid out string
+parameter:
+    Layout  : Layout from Text_Layout
+    Xstart  : Top left corner of the box
+    Ystart  :
+    Color_Foreground : Select the foreground color
+    Color_Background : Fills the box first
+******************************************************************************/
+void Text_Draw(const TEXT_LAYOUT *Layout, UWORD Xstart, UWORD Ystart,
+               UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Row;
+
+    if (Xstart >= Paint.Width || Ystart >= Paint.Height)
+    {
+        Debug("Text_Draw Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    for (Row = 0; Row < Layout->Box_Height && Ystart + Row < Paint.Height; Row++)
+        Paint_DrawSpan(Xstart, Ystart + Row, Layout->Box_Width, Color_Background);
+    Text_DrawRuns(Layout, Xstart, Ystart, Color_Foreground);
+}
+
+/******************************************************************************
+function: Draw a laid out string without touching the box
+parameter:
+    Layout  : Layout from Text_Layout
+    Xstart  : Top left corner of the box
+    Ystart  :
+    Color_Foreground : Select the foreground color
+******************************************************************************/
+void Text_Draw_Transparent(const TEXT_LAYOUT *Layout, UWORD Xstart, UWORD Ystart, UWORD Color_Foreground)
+{
+    if (Xstart >= Paint.Width || Ystart >= Paint.Height)
+    {
+        Debug("Text_Draw_Transparent Input exceeds the normal display range\r\n");
+        return;
+    }
+    Text_DrawRuns(Layout, Xstart, Ystart, Color_Foreground);
+}
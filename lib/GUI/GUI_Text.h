@@ -0,0 +1,72 @@
+/*****************************************************************************
+* | File      	:   GUI_Text.h
+* | Function    :   Text measurement and layout in a box
+* | Info        :
+*                Breaks a UTF-8 string into lines that fit a box, aligns them
+*                and shortens the last line with an ellipsis when the text
+*                does not fit. The result is a list of positioned glyphs that
+*                Text_Draw renders without measuring again.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_TEXT_H
+#define __GUI_TEXT_H
+
+#include "GUI_Paint.h"
+
+/**
+ * Horizontal alignment of the lines in the box
+**/
+typedef enum {
+    TEXT_ALIGN_LEFT = 0,
+    TEXT_ALIGN_CENTER,
+    TEXT_ALIGN_RIGHT,
+} TEXT_ALIGN;
+
+/**
+ * Longest string a layout keeps a copy of, in bytes with the terminating
+ * zero. Text_Layout lays a longer string out on every call.
+**/
+#ifndef TEXT_CACHE_MAX
+#define TEXT_CACHE_MAX      128
+#endif
+
+/**
+ * A glyph placed relative to the top left corner of the box
+**/
+typedef struct {
+    PAINT_GLYPH Glyph;
+    int16_t X;
+    int16_t Y;
+} TEXT_RUN;
+
+/**
+ * Layout of one string, Runs is supplied by the caller
+**/
+typedef struct {
+    TEXT_RUN *Runs;
+    UWORD Max;          // entries in Runs
+    UWORD Count;        // entries used
+    UWORD Box_Width;
+    UWORD Box_Height;
+    UWORD Line_Height;
+    UWORD Lines;        // lines placed
+    UBYTE Truncated;    // text was cut and ends with an ellipsis
+    TEXT_ALIGN Align;
+    PAINT_FONT_SET Fonts;
+    UBYTE Valid;        // Text and the parameters above describe the Runs
+    char Text[TEXT_CACHE_MAX];
+} TEXT_LAYOUT;
+
+void Text_NewLayout(TEXT_LAYOUT *Layout, TEXT_RUN *Runs, UWORD Max);
+UWORD Text_Measure(const char *pString, PAINT_FONT_SET *Fonts);
+UBYTE Text_Layout(TEXT_LAYOUT *Layout, const char *pString, PAINT_FONT_SET *Fonts,
+                  UWORD Box_Width, UWORD Box_Height, TEXT_ALIGN Align);
+void Text_Draw(const TEXT_LAYOUT *Layout, UWORD Xstart, UWORD Ystart,
+               UWORD Color_Foreground, UWORD Color_Background);
+void Text_Draw_Transparent(const TEXT_LAYOUT *Layout, UWORD Xstart, UWORD Ystart, UWORD Color_Foreground);
+
+#endif
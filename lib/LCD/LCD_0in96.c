@@ -18,279 +18,167 @@
 #include <stdio.h>
 
 LCD_0IN96_ATTRIBUTES LCD_0IN96;
+static LCD_DRIVER LCD_0IN96_Driver;
+
+/**
+ * Init sequence
+**/
+static const UBYTE LCD_0IN96_InitSeq[] = {
+    0x11, 0 | LCD_SEQ_DELAY, 120,           // Sleep exit
+    0x21, 0,
+    0x21, 0,
+    0xB1, 3, 0x05, 0x3A, 0x3A,
+    0xB2, 3, 0x05, 0x3A, 0x3A,
+    0xB3, 6, 0x05, 0x3A, 0x3A, 0x05, 0x3A, 0x3A,
+    0xB4, 1, 0x03,
+    0xC0, 3, 0x62, 0x02, 0x04,
+    0xC1, 1, 0xC0,
+    0xC2, 2, 0x0D, 0x00,
+    0xC3, 2, 0x8D, 0x6A,
+    0xC4, 2, 0x8D, 0xEE,
+    0xC5, 1, 0x0E,
+    0xE0, 16, 0x10, 0x0E, 0x02, 0x03, 0x0E, 0x07, 0x02, 0x07,
+              0x0A, 0x12, 0x27, 0x37, 0x00, 0x0D, 0x0E, 0x10,
+    0xE1, 16, 0x10, 0x0E, 0x03, 0x03, 0x0F, 0x06, 0x02, 0x08,
+              0x0A, 0x13, 0x26, 0x36, 0x00, 0x0D, 0x0E, 0x10,
+    0x3A, 1, 0x05,
+    0x36, 1, 0xA8,
+    0x29, 0,
+    0x00, LCD_SEQ_END,
+};
+
+/**
+ * Panel descriptor
+**/
+const LCD_PANEL LCD_0IN96_Panel = {
+    LCD_0IN96_InitSeq,
+    {
+        {LCD_0IN96_WIDTH, LCD_0IN96_HEIGHT, LCD_MADCTL_INIT, 1, 26},   // HORIZONTAL
+        {LCD_0IN96_WIDTH, LCD_0IN96_HEIGHT, LCD_MADCTL_INIT, 1, 26},   // VERTICAL
+    },
+    200,
+    LCD_ST7735_BAUD_MAX,
+    LCD_ST7735_BAUD_RATED,
+    LCD_ST7735_LINES,
+};
 
-
-/******************************************************************************
-function :	Hardware reset
+/********************************************************************************
+function :	Initialize the lcd
 parameter:
-******************************************************************************/
-static void LCD_0IN96_Reset(void)
+		Scan_dir:   Scan direction
+********************************************************************************/
+void LCD_0IN96_Init(UBYTE Scan_dir)
 {
-	DEV_Digital_Write(LCD_RST_PIN, 1);
-    DEV_Delay_ms(200);
-    DEV_Digital_Write(LCD_RST_PIN, 0);
-    DEV_Delay_ms(200);
-    DEV_Digital_Write(LCD_RST_PIN, 1);
-    DEV_Delay_ms(200);
+    DEV_SET_PWM(90);
+    LCD_Driver_Init(&LCD_0IN96_Driver, &LCD_0IN96_Panel, Scan_dir);
+
+    LCD_0IN96.WIDTH = LCD_0IN96_Driver.WIDTH;
+    LCD_0IN96.HEIGHT = LCD_0IN96_Driver.HEIGHT;
+    LCD_0IN96.SCAN_DIR = LCD_0IN96_Driver.SCAN_DIR;
 }
 
-/******************************************************************************
-function :	send command
+/********************************************************************************
+function :	Initialize the lcd without waiting
 parameter:
-     Reg : Command register
-******************************************************************************/
-static void LCD_0IN96_SendCommand(UBYTE Reg)
+		Scan_dir:   Scan direction
+		Task    :   Runs the reset and init sequence, see DEV_Task_Service
+info:
+    The 600 ms reset and the sleep exit delay pass while the main loop gets
+    on with other work. Draw once DEV_Task_Busy(Task) is false.
+********************************************************************************/
+void LCD_0IN96_InitAsync(UBYTE Scan_dir, DEV_TASK *Task)
 {
-    DEV_Digital_Write(LCD_DC_PIN, 0);
-	DEV_Digital_Write(LCD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Reg);
-	//DEV_Digital_Write(LCD_CS_PIN, 1);
+    DEV_SET_PWM(90);
+    LCD_Driver_InitAsync(&LCD_0IN96_Driver, &LCD_0IN96_Panel, Scan_dir);
+
+    LCD_0IN96.WIDTH = LCD_0IN96_Driver.WIDTH;
+    LCD_0IN96.HEIGHT = LCD_0IN96_Driver.HEIGHT;
+    LCD_0IN96.SCAN_DIR = LCD_0IN96_Driver.SCAN_DIR;
+
+    DEV_Task_Start(Task, LCD_Driver_InitTask, &LCD_0IN96_Driver);
 }
 
 /******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
+function :	Raise the SPI clock to the fastest rate the panel takes
+info:
+    See LCD_Driver_Calibrate, returns the rate in Hz.
 ******************************************************************************/
-static void LCD_0IN96_SendData_8Bit(UBYTE Data)
+UDOUBLE LCD_0IN96_Calibrate(void)
 {
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-	DEV_Digital_Write(LCD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Data);
-	DEV_Digital_Write(LCD_CS_PIN, 1);
+    return LCD_Driver_Calibrate(&LCD_0IN96_Driver);
 }
 
 /******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
+function :	Move the panel onto the PIO transport
+info:
+    At the rate LCD_0IN96_Calibrate found, so calibrate first. Returns 0
+    and stays on the hardware SPI when no state machine or DMA channel is
+    free. The other functions keep working, they borrow the pins.
 ******************************************************************************/
-static void LCD_0IN96_SendData_16Bit(UWORD Data)
+UBYTE LCD_0IN96_UsePIO(void)
 {
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-	DEV_Digital_Write(LCD_CS_PIN, 0);
-    DEV_SPI_WriteByte((Data >> 8) & 0xFF);
-    DEV_SPI_WriteByte(Data);
-	DEV_Digital_Write(LCD_CS_PIN, 1);
+    return LCD_PIO_Init(LCD_0IN96_Driver.Baud);
 }
 
 /******************************************************************************
-function :	Initialize the lcd register
+function :	Clear screen
 parameter:
 ******************************************************************************/
-static void LCD_0IN96_InitReg(void)
-{
-  LCD_0IN96_SendCommand(0x11);//Sleep exit 
-	DEV_Delay_ms (120);
-	LCD_0IN96_SendCommand(0x21); 
-	LCD_0IN96_SendCommand(0x21); 
-
-	LCD_0IN96_SendCommand(0xB1); 
-	LCD_0IN96_SendData_8Bit(0x05);
-	LCD_0IN96_SendData_8Bit(0x3A);
-	LCD_0IN96_SendData_8Bit(0x3A);
-
-	LCD_0IN96_SendCommand(0xB2);
-	LCD_0IN96_SendData_8Bit(0x05);
-	LCD_0IN96_SendData_8Bit(0x3A);
-	LCD_0IN96_SendData_8Bit(0x3A);
-
-	LCD_0IN96_SendCommand(0xB3); 
-	LCD_0IN96_SendData_8Bit(0x05);  
-	LCD_0IN96_SendData_8Bit(0x3A);
-	LCD_0IN96_SendData_8Bit(0x3A);
-	LCD_0IN96_SendData_8Bit(0x05);
-	LCD_0IN96_SendData_8Bit(0x3A);
-	LCD_0IN96_SendData_8Bit(0x3A);
-
-	LCD_0IN96_SendCommand(0xB4);
-	LCD_0IN96_SendData_8Bit(0x03);
-
-	LCD_0IN96_SendCommand(0xC0);
-	LCD_0IN96_SendData_8Bit(0x62);
-	LCD_0IN96_SendData_8Bit(0x02);
-	LCD_0IN96_SendData_8Bit(0x04);
-
-	LCD_0IN96_SendCommand(0xC1);
-	LCD_0IN96_SendData_8Bit(0xC0);
-
-	LCD_0IN96_SendCommand(0xC2);
-	LCD_0IN96_SendData_8Bit(0x0D);
-	LCD_0IN96_SendData_8Bit(0x00);
-
-	LCD_0IN96_SendCommand(0xC3);
-	LCD_0IN96_SendData_8Bit(0x8D);
-	LCD_0IN96_SendData_8Bit(0x6A);   
-
-	LCD_0IN96_SendCommand(0xC4);
-	LCD_0IN96_SendData_8Bit(0x8D); 
-	LCD_0IN96_SendData_8Bit(0xEE); 
-
-	LCD_0IN96_SendCommand(0xC5);  /*VCOM*/
-	LCD_0IN96_SendData_8Bit(0x0E);    
-
-	LCD_0IN96_SendCommand(0xE0);
-	LCD_0IN96_SendData_8Bit(0x10);
-	LCD_0IN96_SendData_8Bit(0x0E);
-	LCD_0IN96_SendData_8Bit(0x02);
-	LCD_0IN96_SendData_8Bit(0x03);
-	LCD_0IN96_SendData_8Bit(0x0E);
-	LCD_0IN96_SendData_8Bit(0x07);
-	LCD_0IN96_SendData_8Bit(0x02);
-	LCD_0IN96_SendData_8Bit(0x07);
-	LCD_0IN96_SendData_8Bit(0x0A);
-	LCD_0IN96_SendData_8Bit(0x12);
-	LCD_0IN96_SendData_8Bit(0x27);
-	LCD_0IN96_SendData_8Bit(0x37);
-	LCD_0IN96_SendData_8Bit(0x00);
-	LCD_0IN96_SendData_8Bit(0x0D);
-	LCD_0IN96_SendData_8Bit(0x0E);
-	LCD_0IN96_SendData_8Bit(0x10);
-
-	LCD_0IN96_SendCommand(0xE1);
-	LCD_0IN96_SendData_8Bit(0x10);
-	LCD_0IN96_SendData_8Bit(0x0E);
-	LCD_0IN96_SendData_8Bit(0x03);
-	LCD_0IN96_SendData_8Bit(0x03);
-	LCD_0IN96_SendData_8Bit(0x0F);
-	LCD_0IN96_SendData_8Bit(0x06);
-	LCD_0IN96_SendData_8Bit(0x02);
-	LCD_0IN96_SendData_8Bit(0x08);
-	LCD_0IN96_SendData_8Bit(0x0A);
-	LCD_0IN96_SendData_8Bit(0x13);
-	LCD_0IN96_SendData_8Bit(0x26);
-	LCD_0IN96_SendData_8Bit(0x36);
-	LCD_0IN96_SendData_8Bit(0x00);
-	LCD_0IN96_SendData_8Bit(0x0D);
-	LCD_0IN96_SendData_8Bit(0x0E);
-	LCD_0IN96_SendData_8Bit(0x10);
-
-	LCD_0IN96_SendCommand(0x3A); 
-	LCD_0IN96_SendData_8Bit(0x05);
-
-	LCD_0IN96_SendCommand(0x36);
-	LCD_0IN96_SendData_8Bit(0xA8);
-
-	LCD_0IN96_SendCommand(0x29);
-}
-
-
-/********************************************************************************
-function :	Initialize the lcd
-parameter:
-********************************************************************************/
-void LCD_0IN96_Init(UBYTE Scan_dir)
+void LCD_0IN96_Clear(UWORD Color)
 {
-    DEV_SET_PWM(90);
-    LCD_0IN96_Reset();
-	
-    LCD_0IN96.HEIGHT	= LCD_0IN96_HEIGHT;       
-    LCD_0IN96.WIDTH   = LCD_0IN96_WIDTH;
-	
-    //Set the initialization register
-    LCD_0IN96_InitReg();
-	
+    LCD_Driver_Fill(&LCD_0IN96_Driver, 0, 0, LCD_0IN96.WIDTH, LCD_0IN96.HEIGHT, Color);
 }
 
-/********************************************************************************
-function:	Sets the start position and size of the display area
+/******************************************************************************
+function :	Sends the image buffer in RAM to displays
 parameter:
-		Xstart 	:   X direction Start coordinates
-		Ystart  :   Y direction Start coordinates
-		Xend    :   X direction end coordinates
-		Yend    :   Y direction end coordinates
-********************************************************************************/
-void LCD_0IN96_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+******************************************************************************/
+void LCD_0IN96_Display(UWORD *Image)
 {
-	Xstart = Xstart + 1;
-	Xend = Xend + 1;
-	Ystart = Ystart + 26;
-	Yend = Yend+26;
-	
-	LCD_0IN96_SendCommand(0x2a);
-	LCD_0IN96_SendData_8Bit(Xstart >> 8);
-	LCD_0IN96_SendData_8Bit(Xstart);
-	LCD_0IN96_SendData_8Bit(Xend >> 8);
-	LCD_0IN96_SendData_8Bit(Xend );
-
-	LCD_0IN96_SendCommand(0x2b);
-	LCD_0IN96_SendData_8Bit(Ystart >> 8);
-	LCD_0IN96_SendData_8Bit(Ystart);
-	LCD_0IN96_SendData_8Bit(Yend >> 8);
-	LCD_0IN96_SendData_8Bit(Yend);
-
-	LCD_0IN96_SendCommand(0x2C);
+    LCD_Driver_Display(&LCD_0IN96_Driver, Image);
 }
 
 /******************************************************************************
-function :	Clear screen
+function :	Sends windows of the image buffer in the background
 parameter:
+		Stream 	:   At least LCD_WINDOW_WORDS words
+		Chain  	:   At least LCD_CHAIN_MIN blocks
+		Rects  	:   Windows, ends exclusive
+		Count  	:   Number of windows
+		Image	:	The whole image, untouched until LCD_PIO_Busy returns 0
+info:
+    See LCD_Driver_DisplayRectsAsync.
 ******************************************************************************/
-void LCD_0IN96_Clear(UWORD Color)
+UBYTE LCD_0IN96_DisplayRects(LCD_STREAM *Stream, LCD_PIO_CHAIN *Chain, const LCD_RECT *Rects, UWORD Count,
+                             UWORD *Image)
 {
-    UWORD j,i;
-    UWORD Image[LCD_0IN96.WIDTH*LCD_0IN96.HEIGHT];
-    
-    Color = ((Color<<8)&0xff00)|(Color>>8);
-   
-    for (j = 0; j < LCD_0IN96.HEIGHT*LCD_0IN96.WIDTH; j++) {
-        Image[j] = Color;
-    }
-    
-    LCD_0IN96_SetWindows(0, 0, LCD_0IN96.WIDTH-1, LCD_0IN96.HEIGHT-1);
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-	
-    // for(j = 0; j < LCD_0IN96.WIDTH*LCD_0IN96.HEIGHT; j++){
-        // LCD_0IN96_SendData_16Bit(Image[j]);	
-		
-	for(j = 0; j < LCD_0IN96.HEIGHT; j++){
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_0IN96.WIDTH], LCD_0IN96.WIDTH*2);
-    }
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    return LCD_Driver_DisplayRectsAsync(&LCD_0IN96_Driver, Stream, Chain, Rects, Count, Image, NULL);
 }
 
 /******************************************************************************
-function :	Sends the image buffer in RAM to displays
+function :	Sends part of the image buffer in RAM to displays
 parameter:
+		Xstart 	:   X direction Start coordinates
+		Ystart  :   Y direction Start coordinates
+		Xend    :   X direction end coordinates, exclusive
+		Yend    :   Y direction end coordinates, exclusive
+		Image	:	The whole image
 ******************************************************************************/
-void LCD_0IN96_Display(UWORD *Image)
-{
-    UWORD j;
-    LCD_0IN96_SetWindows(0, 0, LCD_0IN96.WIDTH-1, LCD_0IN96.HEIGHT-1);
-    DEV_Digital_Write(LCD_DC_PIN, 1);
- //   DEV_Digital_Write(LCD_CS_PIN, 0);
-	
-    for (j = 0; j < LCD_0IN96.HEIGHT; j++) {
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_0IN96.WIDTH], LCD_0IN96.WIDTH*2);
-		
-	// for(j = 0; j < LCD_0IN96.WIDTH*LCD_0IN96.HEIGHT; j++){
-        // LCD_0IN96_SendData_16Bit(Image[j]);		
-    }
-//    DEV_Digital_Write(LCD_CS_PIN, 1);
-    //LCD_0IN96_SendCommand(0x29);
-}
-
 void LCD_0IN96_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
 {
-    // display
-    UDOUBLE Addr = 0;
-
-    UWORD j;
-    LCD_0IN96_SetWindows(Xstart, Ystart, Xend , Yend);
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    for (j = Ystart; j < Yend - 1; j++) {
-        Addr = Xstart + j * LCD_0IN96.WIDTH ;
-        DEV_SPI_Write_nByte((uint8_t *)&Image[Addr], (Xend-Xstart)*2);
-    }
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    LCD_Driver_DisplayWindows(&LCD_0IN96_Driver, Xstart, Ystart, Xend, Yend, Image);
 }
 
+/******************************************************************************
+function :	Change the color of a point
+parameter:
+		X 		:   X coordinates
+		Y  		:   Y coordinates
+		Color	:	Color
+******************************************************************************/
 void LCD_0IN96_DisplayPoint(UWORD X, UWORD Y, UWORD Color)
 {
-    LCD_0IN96_SetWindows(X,Y,X,Y);
-    LCD_0IN96_SendData_16Bit(Color);
+    LCD_Driver_Fill(&LCD_0IN96_Driver, X, Y, X + 1, Y + 1, Color);
 }
 
 void  Handler_0IN96_LCD(int signo)
@@ -15,6 +15,7 @@
 #define __LCD_0IN96_H
 
 #include "DEV_Config.h"
+#include "LCD_Driver.h"
 #include <stdint.h>
 
 #include <stdlib.h>     //itoa()
@@ -37,14 +38,20 @@ typedef struct{
     UBYTE SCAN_DIR;
 }LCD_0IN96_ATTRIBUTES;
 extern LCD_0IN96_ATTRIBUTES LCD_0IN96;
+extern const LCD_PANEL LCD_0IN96_Panel;
 
 /********************************************************************************
 function:	
 			Macro definition variable name
 ********************************************************************************/
 void LCD_0IN96_Init(UBYTE Scan_dir);
+void LCD_0IN96_InitAsync(UBYTE Scan_dir, DEV_TASK *Task);
+UDOUBLE LCD_0IN96_Calibrate(void);
+UBYTE LCD_0IN96_UsePIO(void);
 void LCD_0IN96_Clear(UWORD Color);
 void LCD_0IN96_Display(UWORD *Image);
+UBYTE LCD_0IN96_DisplayRects(LCD_STREAM *Stream, LCD_PIO_CHAIN *Chain, const LCD_RECT *Rects, UWORD Count,
+                             UWORD *Image);
 void LCD_0IN96_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
 void LCD_0IN96_DisplayPoint(UWORD X, UWORD Y, UWORD Color);
 
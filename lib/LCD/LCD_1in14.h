@@ -2,6 +2,7 @@
 #define __LCD_1IN14_H
 
 #include "DEV_Config.h"
+#include "LCD_Driver.h"
 #include <stdint.h>
 
 #include <stdlib.h>     //itoa()
@@ -24,14 +25,19 @@ typedef struct{
     UBYTE SCAN_DIR;
 }LCD_1IN14_ATTRIBUTES;
 extern LCD_1IN14_ATTRIBUTES LCD_1IN14;
+extern const LCD_PANEL LCD_1IN14_Panel;
 
 /********************************************************************************
 function:	
 			Macro definition variable name
 ********************************************************************************/
 void LCD_1IN14_Init(UBYTE Scan_dir);
+UDOUBLE LCD_1IN14_Calibrate(void);
+UBYTE LCD_1IN14_UsePIO(void);
 void LCD_1IN14_Clear(UWORD Color);
 void LCD_1IN14_Display(UWORD *Image);
+UBYTE LCD_1IN14_DisplayRects(LCD_STREAM *Stream, LCD_PIO_CHAIN *Chain, const LCD_RECT *Rects, UWORD Count,
+                             UWORD *Image);
 void LCD_1IN14_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
 void LCD_1IN14_DisplayPoint(UWORD X, UWORD Y, UWORD Color);
 
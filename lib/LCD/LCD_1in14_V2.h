@@ -31,6 +31,7 @@
 
 
 #include "DEV_Config.h"
+#include "LCD_Driver.h"
 #include <stdint.h>
 
 #include <stdlib.h>     //itoa()
@@ -53,14 +54,19 @@ typedef struct{
     UBYTE SCAN_DIR;
 }LCD_1IN14_V2_ATTRIBUTES;
 extern LCD_1IN14_V2_ATTRIBUTES LCD_1IN14_V2;
+extern const LCD_PANEL LCD_1IN14_V2_Panel;
 
 /********************************************************************************
 function:	
 			Macro definition variable name
 ********************************************************************************/
 void LCD_1IN14_V2_Init(UBYTE Scan_dir);
+UDOUBLE LCD_1IN14_V2_Calibrate(void);
+UBYTE LCD_1IN14_V2_UsePIO(void);
 void LCD_1IN14_V2_Clear(UWORD Color);
 void LCD_1IN14_V2_Display(UWORD *Image);
+UBYTE LCD_1IN14_V2_DisplayRects(LCD_STREAM *Stream, LCD_PIO_CHAIN *Chain, const LCD_RECT *Rects, UWORD Count,
+                                UWORD *Image);
 void LCD_1IN14_V2_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
 void LCD_1IN14_V2_DisplayPoint(UWORD X, UWORD Y, UWORD Color);
 
@@ -15,6 +15,7 @@
 #define __LCD_1IN3_H
 
 #include "DEV_Config.h"
+#include "LCD_Driver.h"
 #include <stdint.h>
 
 #include <stdlib.h>     //itoa()
@@ -37,14 +38,19 @@ typedef struct{
     UBYTE SCAN_DIR;
 }LCD_1IN3_ATTRIBUTES;
 extern LCD_1IN3_ATTRIBUTES LCD_1IN3;
+extern const LCD_PANEL LCD_1IN3_Panel;
 
 /********************************************************************************
 function:	
 			Macro definition variable name
 ********************************************************************************/
 void LCD_1IN3_Init(UBYTE Scan_dir);
+UDOUBLE LCD_1IN3_Calibrate(void);
+UBYTE LCD_1IN3_UsePIO(void);
 void LCD_1IN3_Clear(UWORD Color);
 void LCD_1IN3_Display(UWORD *Image);
+UBYTE LCD_1IN3_DisplayRects(LCD_STREAM *Stream, LCD_PIO_CHAIN *Chain, const LCD_RECT *Rects, UWORD Count,
+                            UWORD *Image);
 void LCD_1IN3_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
 void LCD_1IN3_DisplayPoint(UWORD X, UWORD Y, UWORD Color);
 
@@ -18,298 +18,143 @@
 #include <stdio.h>
 
 LCD_1IN44_ATTRIBUTES LCD_1IN44;
+static LCD_DRIVER LCD_1IN44_Driver;
+
+/**
+ * Init sequence
+**/
+static const UBYTE LCD_1IN44_InitSeq[] = {
+    0x3A, 1, 0x05,
+    0xB1, 3, 0x01, 0x2C, 0x2D,
+    0xB2, 3, 0x01, 0x2C, 0x2D,
+    0xB3, 6, 0x01, 0x2C, 0x2D, 0x01, 0x2C, 0x2D,
+    0xB4, 1, 0x07,                          // Column inversion
+    0xC0, 3, 0xA2, 0x02, 0x84,
+    0xC1, 1, 0xC5,
+    0xC2, 2, 0x0A, 0x00,
+    0xC3, 2, 0x8A, 0x2A,
+    0xC4, 2, 0x8A, 0xEE,
+    0xC5, 1, 0x0E,                          // VCOM
+    0xE0, 16, 0x0F, 0x1A, 0x0F, 0x18, 0x2F, 0x28, 0x20, 0x22,
+              0x1F, 0x1B, 0x23, 0x37, 0x00, 0x07, 0x02, 0x10,
+    0xE1, 16, 0x0F, 0x1B, 0x0F, 0x17, 0x33, 0x2C, 0x29, 0x2E,
+              0x30, 0x30, 0x39, 0x3F, 0x00, 0x07, 0x03, 0x10,
+    0x11, 0 | LCD_SEQ_DELAY, 120,
+    0x29, 0,
+    0x00, LCD_SEQ_END,
+};
+
+/**
+ * Panel descriptor
+**/
+const LCD_PANEL LCD_1IN44_Panel = {
+    LCD_1IN44_InitSeq,
+    {
+        {LCD_1IN44_HEIGHT, LCD_1IN44_WIDTH, 0x78, 1, 2},   // HORIZONTAL
+        {LCD_1IN44_WIDTH, LCD_1IN44_HEIGHT, 0x00, 2, 1},   // VERTICAL
+    },
+    100,
+    LCD_ST7735_BAUD_MAX,
+    LCD_ST7735_BAUD_RATED,
+    LCD_ST7735_LINES,
+};
 
-
-/******************************************************************************
-function :	Hardware reset
+/********************************************************************************
+function :	Initialize the lcd
 parameter:
-******************************************************************************/
-static void LCD_1IN44_Reset(void)
+		Scan_dir:   Scan direction
+********************************************************************************/
+void LCD_1IN44_Init(UBYTE Scan_dir)
 {
-    DEV_Digital_Write(LCD_RST_PIN, 1);
-    DEV_Delay_ms(100);
-    DEV_Digital_Write(LCD_RST_PIN, 0);
-    DEV_Delay_ms(100);
-    DEV_Digital_Write(LCD_RST_PIN, 1);
-    DEV_Delay_ms(100);
+    DEV_SET_PWM(90);
+    LCD_Driver_Init(&LCD_1IN44_Driver, &LCD_1IN44_Panel, Scan_dir);
+
+    LCD_1IN44.WIDTH = LCD_1IN44_Driver.WIDTH;
+    LCD_1IN44.HEIGHT = LCD_1IN44_Driver.HEIGHT;
+    LCD_1IN44.SCAN_DIR = LCD_1IN44_Driver.SCAN_DIR;
 }
 
 /******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
+function :	Raise the SPI clock to the fastest rate the panel takes
+info:
+    See LCD_Driver_Calibrate, returns the rate in Hz.
 ******************************************************************************/
-static void LCD_1IN44_SendCommand(UBYTE Reg)
+UDOUBLE LCD_1IN44_Calibrate(void)
 {
-    DEV_Digital_Write(LCD_DC_PIN, 0);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Reg);
-   // DEV_Digital_Write(LCD_CS_PIN, 1);
+    return LCD_Driver_Calibrate(&LCD_1IN44_Driver);
 }
 
 /******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
+function :	Move the panel onto the PIO transport
+info:
+    At the rate LCD_1IN44_Calibrate found, so calibrate first. Returns 0
+    and stays on the hardware SPI when no state machine or DMA channel is
+    free. The other functions keep working, they borrow the pins.
 ******************************************************************************/
-static void LCD_1IN44_SendData_8Bit(UBYTE Data)
+UBYTE LCD_1IN44_UsePIO(void)
 {
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Data);
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    return LCD_PIO_Init(LCD_1IN44_Driver.Baud);
 }
 
 /******************************************************************************
-function :	send data
+function :	Clear screen
 parameter:
-    Data : Write data
 ******************************************************************************/
-static void LCD_1IN44_SendData_16Bit(UWORD Data)
+void LCD_1IN44_Clear(UWORD Color)
 {
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    DEV_SPI_WriteByte((Data >> 8) & 0xFF);
-    DEV_SPI_WriteByte(Data & 0xFF);
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    LCD_Driver_Fill(&LCD_1IN44_Driver, 0, 0, LCD_1IN44.WIDTH, LCD_1IN44.HEIGHT, Color);
 }
 
 /******************************************************************************
-function :	Initialize the lcd register
+function :	Sends the image buffer in RAM to displays
 parameter:
 ******************************************************************************/
-static void LCD_1IN44_InitReg(void)
+void LCD_1IN44_Display(UWORD *Image)
 {
-    LCD_1IN44_SendCommand(0x3A);
-    LCD_1IN44_SendData_8Bit(0x05);
-
-     //ST7735R Frame Rate
-    LCD_1IN44_SendCommand(0xB1);
-    LCD_1IN44_SendData_8Bit(0x01);
-    LCD_1IN44_SendData_8Bit(0x2C);
-    LCD_1IN44_SendData_8Bit(0x2D);
-
-    LCD_1IN44_SendCommand(0xB2);
-    LCD_1IN44_SendData_8Bit(0x01);
-    LCD_1IN44_SendData_8Bit(0x2C);
-    LCD_1IN44_SendData_8Bit(0x2D);
-
-    LCD_1IN44_SendCommand(0xB3);
-    LCD_1IN44_SendData_8Bit(0x01);
-    LCD_1IN44_SendData_8Bit(0x2C);
-    LCD_1IN44_SendData_8Bit(0x2D);
-    LCD_1IN44_SendData_8Bit(0x01);
-    LCD_1IN44_SendData_8Bit(0x2C);
-    LCD_1IN44_SendData_8Bit(0x2D);
-
-    LCD_1IN44_SendCommand(0xB4); //Column inversion
-    LCD_1IN44_SendData_8Bit(0x07);
-
-    //ST7735R Power Sequence
-    LCD_1IN44_SendCommand(0xC0);
-    LCD_1IN44_SendData_8Bit(0xA2);
-    LCD_1IN44_SendData_8Bit(0x02);
-    LCD_1IN44_SendData_8Bit(0x84);
-    LCD_1IN44_SendCommand(0xC1);
-    LCD_1IN44_SendData_8Bit(0xC5);
-
-    LCD_1IN44_SendCommand(0xC2);
-    LCD_1IN44_SendData_8Bit(0x0A);
-    LCD_1IN44_SendData_8Bit(0x00);
-
-    LCD_1IN44_SendCommand(0xC3);
-    LCD_1IN44_SendData_8Bit(0x8A);
-    LCD_1IN44_SendData_8Bit(0x2A);
-    LCD_1IN44_SendCommand(0xC4);
-    LCD_1IN44_SendData_8Bit(0x8A);
-    LCD_1IN44_SendData_8Bit(0xEE);
-
-    LCD_1IN44_SendCommand(0xC5); //VCOM
-    LCD_1IN44_SendData_8Bit(0x0E);
-
-    //ST7735R Gamma Sequence
-    LCD_1IN44_SendCommand(0xe0);
-    LCD_1IN44_SendData_8Bit(0x0f);
-    LCD_1IN44_SendData_8Bit(0x1a);
-    LCD_1IN44_SendData_8Bit(0x0f);
-    LCD_1IN44_SendData_8Bit(0x18);
-    LCD_1IN44_SendData_8Bit(0x2f);
-    LCD_1IN44_SendData_8Bit(0x28);
-    LCD_1IN44_SendData_8Bit(0x20);
-    LCD_1IN44_SendData_8Bit(0x22);
-    LCD_1IN44_SendData_8Bit(0x1f);
-    LCD_1IN44_SendData_8Bit(0x1b);
-    LCD_1IN44_SendData_8Bit(0x23);
-    LCD_1IN44_SendData_8Bit(0x37);
-    LCD_1IN44_SendData_8Bit(0x00);
-    LCD_1IN44_SendData_8Bit(0x07);
-    LCD_1IN44_SendData_8Bit(0x02);
-    LCD_1IN44_SendData_8Bit(0x10);
-
-    LCD_1IN44_SendCommand(0xe1);
-    LCD_1IN44_SendData_8Bit(0x0f);
-    LCD_1IN44_SendData_8Bit(0x1b);
-    LCD_1IN44_SendData_8Bit(0x0f);
-    LCD_1IN44_SendData_8Bit(0x17);
-    LCD_1IN44_SendData_8Bit(0x33);
-    LCD_1IN44_SendData_8Bit(0x2c);
-    LCD_1IN44_SendData_8Bit(0x29);
-    LCD_1IN44_SendData_8Bit(0x2e);
-    LCD_1IN44_SendData_8Bit(0x30);
-    LCD_1IN44_SendData_8Bit(0x30);
-    LCD_1IN44_SendData_8Bit(0x39);
-    LCD_1IN44_SendData_8Bit(0x3f);
-    LCD_1IN44_SendData_8Bit(0x00);
-    LCD_1IN44_SendData_8Bit(0x07);
-    LCD_1IN44_SendData_8Bit(0x03);
-    LCD_1IN44_SendData_8Bit(0x10);
-	
-	//LCD_1IN44_SendCommand(0x21);// reverse
-    LCD_1IN44_SendCommand(0x11);
-    DEV_Delay_ms(120);
-
-    //Turn on the LCD display
-    LCD_1IN44_SendCommand(0x29);
-
+    LCD_Driver_Display(&LCD_1IN44_Driver, Image);
 }
 
-/********************************************************************************
-function:	Set the resolution and scanning method of the screen
-parameter:
-		Scan_dir:   Scan direction
-********************************************************************************/
-static void LCD_1IN44_SetAttributes(UBYTE Scan_dir)
-{
-    //Get the screen scan direction
-    LCD_1IN44.SCAN_DIR = Scan_dir;
-    UBYTE MemoryAccessReg = 0x00;
-
-    //Get GRAM and LCD width and height
-    if(Scan_dir == HORIZONTAL) {
-        LCD_1IN44.HEIGHT	= LCD_1IN44_WIDTH;
-        LCD_1IN44.WIDTH   = LCD_1IN44_HEIGHT;
-        MemoryAccessReg = 0X78;
-    } else {
-        LCD_1IN44.HEIGHT	= LCD_1IN44_HEIGHT;       
-        LCD_1IN44.WIDTH   = LCD_1IN44_WIDTH;
-        MemoryAccessReg = 0X00;
-    }
-
-    // Set the read / write scan direction of the frame memory
-    LCD_1IN44_SendCommand(0x36); //MX, MY, RGB mode
-    LCD_1IN44_SendData_8Bit(MemoryAccessReg);	//0x08 set RGB
-}
-
-/********************************************************************************
-function :	Initialize the lcd
+/******************************************************************************
+function :	Sends windows of the image buffer in the background
 parameter:
-********************************************************************************/
-void LCD_1IN44_Init(UBYTE Scan_dir)
+		Stream 	:   At least LCD_WINDOW_WORDS words
+		Chain  	:   At least LCD_CHAIN_MIN blocks
+		Rects  	:   Windows, ends exclusive
+		Count  	:   Number of windows
+		Image	:	The whole image, untouched until LCD_PIO_Busy returns 0
+info:
+    See LCD_Driver_DisplayRectsAsync.
+******************************************************************************/
+UBYTE LCD_1IN44_DisplayRects(LCD_STREAM *Stream, LCD_PIO_CHAIN *Chain, const LCD_RECT *Rects, UWORD Count,
+                             UWORD *Image)
 {
-    DEV_SET_PWM(90);
-    //Hardware reset   
-    LCD_1IN44_Reset();
-
-    //Set the resolution and scanning method of the screen
-    LCD_1IN44_SetAttributes(Scan_dir);
-    
-    //Set the initialization register
-    LCD_1IN44_InitReg();
-
-
+    return LCD_Driver_DisplayRectsAsync(&LCD_1IN44_Driver, Stream, Chain, Rects, Count, Image, NULL);
 }
 
-/********************************************************************************
-function:	Sets the start position and size of the display area
+/******************************************************************************
+function :	Sends part of the image buffer in RAM to displays
 parameter:
 		Xstart 	:   X direction Start coordinates
 		Ystart  :   Y direction Start coordinates
-		Xend    :   X direction end coordinates
-		Yend    :   Y direction end coordinates
-********************************************************************************/
-void LCD_1IN44_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
-{
-    UBYTE x,y;
-    if(LCD_1IN44.SCAN_DIR == HORIZONTAL){x=1;y=2;}
-    else{ x=2; y=1; }
-    //set the X coordinates
-    LCD_1IN44_SendCommand(0x2A);
-    
-    
-    LCD_1IN44_SendData_16Bit(Xstart	+x);
-    LCD_1IN44_SendData_16Bit(Xend-1	+x);
-    //set the Y coordinates
-    LCD_1IN44_SendCommand(0x2B);
-    LCD_1IN44_SendData_16Bit(Ystart +y);
-    LCD_1IN44_SendData_16Bit(Yend-1	  +y);
-
-    LCD_1IN44_SendCommand(0X2C);
-    // printf("%d %d\r\n",x,y);
-}
-
-/******************************************************************************
-function :	Clear screen
-parameter:
+		Xend    :   X direction end coordinates, exclusive
+		Yend    :   Y direction end coordinates, exclusive
+		Image	:	The whole image
 ******************************************************************************/
-void LCD_1IN44_Clear(UWORD Color)
+void LCD_1IN44_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
 {
-    UWORD j,i;
-    UWORD Image[LCD_1IN44.WIDTH*LCD_1IN44.HEIGHT];
-    
-    Color = ((Color<<8)&0xff00)|(Color>>8);
-   
-    for (j = 0; j < LCD_1IN44.HEIGHT*LCD_1IN44.WIDTH; j++) {
-        Image[j] = Color;
-    }
-    
-    LCD_1IN44_SetWindows(0, 0, LCD_1IN44.WIDTH, LCD_1IN44.HEIGHT);
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    // printf("HEIGHT %d, WIDTH %d\r\n",LCD_1IN44.HEIGHT,LCD_1IN44.WIDTH);
-    for(j = 0; j < LCD_1IN44.HEIGHT; j++){
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN44.WIDTH], LCD_1IN44.WIDTH*2);
-        
-    }
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    LCD_Driver_DisplayWindows(&LCD_1IN44_Driver, Xstart, Ystart, Xend, Yend, Image);
 }
 
 /******************************************************************************
-function :	Sends the image buffer in RAM to displays
+function :	Change the color of a point
 parameter:
+		X 		:   X coordinates
+		Y  		:   Y coordinates
+		Color	:	Color
 ******************************************************************************/
-void LCD_1IN44_Display(UWORD *Image)
-{
-    UWORD j;
-    LCD_1IN44_SetWindows(0, 0, LCD_1IN44.WIDTH, LCD_1IN44.HEIGHT);
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    for (j = 0; j < LCD_1IN44.HEIGHT; j++) {
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN44.WIDTH], LCD_1IN44.WIDTH*2);
-    }
-    DEV_Digital_Write(LCD_CS_PIN, 1);
-    LCD_1IN44_SendCommand(0x29);
-}
-  
-void LCD_1IN44_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
-{
-    // display
-    UDOUBLE Addr = 0;
-
-    UWORD j;
-    LCD_1IN44_SetWindows(Xstart, Ystart, Xend , Yend);
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    for (j = Ystart; j < Yend - 1; j++) {
-        Addr = Xstart + j * LCD_1IN44.WIDTH ;
-        DEV_SPI_Write_nByte((uint8_t *)&Image[Addr], (Xend-Xstart)*2);
-    }
-    DEV_Digital_Write(LCD_CS_PIN, 1);
-}
-
 void LCD_1IN44_DisplayPoint(UWORD X, UWORD Y, UWORD Color)
 {
-    LCD_1IN44_SetWindows(X,Y,X,Y);
-    LCD_1IN44_SendData_16Bit(Color);
+    LCD_Driver_Fill(&LCD_1IN44_Driver, X, Y, X + 1, Y + 1, Color);
 }
 
 void  Handler_1IN44_LCD(int signo)
@@ -319,4 +164,3 @@ void  Handler_1IN44_LCD(int signo)
     DEV_Module_Exit();
 	exit(0);
 }
-
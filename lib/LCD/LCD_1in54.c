@@ -5,272 +5,125 @@
 #include <stdio.h>
 
 LCD_1IN54_ATTRIBUTES LCD_1IN54;
+static LCD_DRIVER LCD_1IN54_Driver;
+
+/**
+ * Panel descriptor
+**/
+const LCD_PANEL LCD_1IN54_Panel = {
+    LCD_ST7789_Init,
+    {
+        {LCD_1IN54_WIDTH, LCD_1IN54_HEIGHT, 0x70, 0, 0},   // HORIZONTAL
+        {LCD_1IN54_HEIGHT, LCD_1IN54_WIDTH, 0x00, 0, 0},   // VERTICAL
+    },
+    100,
+    LCD_ST7789_BAUD_MAX,
+    LCD_ST7789_BAUD_RATED,
+    LCD_ST7789_LINES,
+};
 
-
-/******************************************************************************
-function :	Hardware reset
+/********************************************************************************
+function :	Initialize the lcd
 parameter:
-******************************************************************************/
-static void LCD_1IN54_Reset(void)
+		Scan_dir:   Scan direction
+********************************************************************************/
+void LCD_1IN54_Init(UBYTE Scan_dir)
 {
-    DEV_Digital_Write(LCD_RST_PIN, 1);
-    DEV_Delay_ms(100);
-    DEV_Digital_Write(LCD_RST_PIN, 0);
-    DEV_Delay_ms(100);
-    DEV_Digital_Write(LCD_RST_PIN, 1);
-    DEV_Delay_ms(100);
+    DEV_SET_PWM(90);
+    LCD_Driver_Init(&LCD_1IN54_Driver, &LCD_1IN54_Panel, Scan_dir);
+
+    LCD_1IN54.WIDTH = LCD_1IN54_Driver.WIDTH;
+    LCD_1IN54.HEIGHT = LCD_1IN54_Driver.HEIGHT;
+    LCD_1IN54.SCAN_DIR = LCD_1IN54_Driver.SCAN_DIR;
 }
 
 /******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
+function :	Raise the SPI clock to the fastest rate the panel takes
+info:
+    See LCD_Driver_Calibrate, returns the rate in Hz.
 ******************************************************************************/
-static void LCD_1IN54_SendCommand(UBYTE Reg)
+UDOUBLE LCD_1IN54_Calibrate(void)
 {
-    DEV_Digital_Write(LCD_DC_PIN, 0);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Reg);
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    return LCD_Driver_Calibrate(&LCD_1IN54_Driver);
 }
 
 /******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
+function :	Move the panel onto the PIO transport
+info:
+    At the rate LCD_1IN54_Calibrate found, so calibrate first. Returns 0
+    and stays on the hardware SPI when no state machine or DMA channel is
+    free. The other functions keep working, they borrow the pins.
 ******************************************************************************/
-static void LCD_1IN54_SendData_8Bit(UBYTE Data)
+UBYTE LCD_1IN54_UsePIO(void)
 {
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Data);
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    return LCD_PIO_Init(LCD_1IN54_Driver.Baud);
 }
 
 /******************************************************************************
-function :	send data
+function :	Clear screen
 parameter:
-    Data : Write data
 ******************************************************************************/
-static void LCD_1IN54_SendData_16Bit(UWORD Data)
+void LCD_1IN54_Clear(UWORD Color)
 {
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    DEV_SPI_WriteByte((Data >> 8) & 0xFF);
-    DEV_SPI_WriteByte(Data & 0xFF);
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    LCD_Driver_Fill(&LCD_1IN54_Driver, 0, 0, LCD_1IN54.WIDTH, LCD_1IN54.HEIGHT, Color);
 }
 
 /******************************************************************************
-function :	Initialize the lcd register
+function :	Sends the image buffer in RAM to displays
 parameter:
 ******************************************************************************/
-static void LCD_1IN54_InitReg(void)
-{
-    LCD_1IN54_SendCommand(0x3A);
-    LCD_1IN54_SendData_8Bit(0x05);
-
-    LCD_1IN54_SendCommand(0xB2);
-    LCD_1IN54_SendData_8Bit(0x0C);
-    LCD_1IN54_SendData_8Bit(0x0C);
-    LCD_1IN54_SendData_8Bit(0x00);
-    LCD_1IN54_SendData_8Bit(0x33);
-    LCD_1IN54_SendData_8Bit(0x33);
-
-    LCD_1IN54_SendCommand(0xB7);  //Gate Control
-    LCD_1IN54_SendData_8Bit(0x35);
-
-    LCD_1IN54_SendCommand(0xBB);  //VCOM Setting
-    LCD_1IN54_SendData_8Bit(0x19);
-
-    LCD_1IN54_SendCommand(0xC0); //LCM Control     
-    LCD_1IN54_SendData_8Bit(0x2C);
-
-    LCD_1IN54_SendCommand(0xC2);  //VDV and VRH Command Enable
-    LCD_1IN54_SendData_8Bit(0x01);
-    LCD_1IN54_SendCommand(0xC3);  //VRH Set
-    LCD_1IN54_SendData_8Bit(0x12);
-    LCD_1IN54_SendCommand(0xC4);  //VDV Set
-    LCD_1IN54_SendData_8Bit(0x20);
-
-    LCD_1IN54_SendCommand(0xC6);  //Frame Rate Control in Normal Mode
-    LCD_1IN54_SendData_8Bit(0x0F);
-    
-    LCD_1IN54_SendCommand(0xD0);  // Power Control 1
-    LCD_1IN54_SendData_8Bit(0xA4);
-    LCD_1IN54_SendData_8Bit(0xA1);
-
-    LCD_1IN54_SendCommand(0xE0);  //Positive Voltage Gamma Control
-    LCD_1IN54_SendData_8Bit(0xD0);
-    LCD_1IN54_SendData_8Bit(0x04);
-    LCD_1IN54_SendData_8Bit(0x0D);
-    LCD_1IN54_SendData_8Bit(0x11);
-    LCD_1IN54_SendData_8Bit(0x13);
-    LCD_1IN54_SendData_8Bit(0x2B);
-    LCD_1IN54_SendData_8Bit(0x3F);
-    LCD_1IN54_SendData_8Bit(0x54);
-    LCD_1IN54_SendData_8Bit(0x4C);
-    LCD_1IN54_SendData_8Bit(0x18);
-    LCD_1IN54_SendData_8Bit(0x0D);
-    LCD_1IN54_SendData_8Bit(0x0B);
-    LCD_1IN54_SendData_8Bit(0x1F);
-    LCD_1IN54_SendData_8Bit(0x23);
-
-    LCD_1IN54_SendCommand(0xE1);  //Negative Voltage Gamma Control
-    LCD_1IN54_SendData_8Bit(0xD0);
-    LCD_1IN54_SendData_8Bit(0x04);
-    LCD_1IN54_SendData_8Bit(0x0C);
-    LCD_1IN54_SendData_8Bit(0x11);
-    LCD_1IN54_SendData_8Bit(0x13);
-    LCD_1IN54_SendData_8Bit(0x2C);
-    LCD_1IN54_SendData_8Bit(0x3F);
-    LCD_1IN54_SendData_8Bit(0x44);
-    LCD_1IN54_SendData_8Bit(0x51);
-    LCD_1IN54_SendData_8Bit(0x2F);
-    LCD_1IN54_SendData_8Bit(0x1F);
-    LCD_1IN54_SendData_8Bit(0x1F);
-    LCD_1IN54_SendData_8Bit(0x20);
-    LCD_1IN54_SendData_8Bit(0x23);
-
-    LCD_1IN54_SendCommand(0x21);  //Display Inversion On
-
-    LCD_1IN54_SendCommand(0x11);  //Sleep Out
-
-    LCD_1IN54_SendCommand(0x29);  //Display On
-}
-
-/********************************************************************************
-function:	Set the resolution and scanning method of the screen
-parameter:
-		Scan_dir:   Scan direction
-********************************************************************************/
-static void LCD_1IN54_SetAttributes(UBYTE Scan_dir)
+void LCD_1IN54_Display(UWORD *Image)
 {
-    //Get the screen scan direction
-    LCD_1IN54.SCAN_DIR = Scan_dir;
-    UBYTE MemoryAccessReg = 0x00;
-
-    //Get GRAM and LCD width and height
-    if(Scan_dir == HORIZONTAL) {
-        LCD_1IN54.HEIGHT	= LCD_1IN54_HEIGHT;
-        LCD_1IN54.WIDTH   = LCD_1IN54_WIDTH;
-        MemoryAccessReg = 0X70;
-    } else {
-        LCD_1IN54.HEIGHT	= LCD_1IN54_WIDTH;
-        LCD_1IN54.WIDTH   = LCD_1IN54_HEIGHT;
-        MemoryAccessReg = 0X00;
-    }
-
-    // Set the read / write scan direction of the frame memory
-    LCD_1IN54_SendCommand(0x36); //MX, MY, RGB mode
-    LCD_1IN54_SendData_8Bit(MemoryAccessReg);	//0x08 set RGB
+    LCD_Driver_Display(&LCD_1IN54_Driver, Image);
 }
 
-/********************************************************************************
-function :	Initialize the lcd
+/******************************************************************************
+function :	Sends windows of the image buffer in the background
 parameter:
-********************************************************************************/
-void LCD_1IN54_Init(UBYTE Scan_dir)
+		Stream 	:   At least LCD_WINDOW_WORDS words
+		Chain  	:   At least LCD_CHAIN_MIN blocks
+		Rects  	:   Windows, ends exclusive
+		Count  	:   Number of windows
+		Image	:	The whole image, untouched until LCD_PIO_Busy returns 0
+info:
+    See LCD_Driver_DisplayRectsAsync.
+******************************************************************************/
+UBYTE LCD_1IN54_DisplayRects(LCD_STREAM *Stream, LCD_PIO_CHAIN *Chain, const LCD_RECT *Rects, UWORD Count,
+                             UWORD *Image)
 {
-    //Turn on the backlight
-    // LCD_1IN54_BL_1;
-
-    //Hardware reset
-    LCD_1IN54_Reset();
-
-    //Set the resolution and scanning method of the screen
-    LCD_1IN54_SetAttributes(Scan_dir);
-    
-    //Set the initialization register
-    LCD_1IN54_InitReg();
+    return LCD_Driver_DisplayRectsAsync(&LCD_1IN54_Driver, Stream, Chain, Rects, Count, Image, NULL);
 }
 
-/********************************************************************************
-function:	Sets the start position and size of the display area
+/******************************************************************************
+function :	Sends part of the image buffer in RAM to displays
 parameter:
 		Xstart 	:   X direction Start coordinates
 		Ystart  :   Y direction Start coordinates
-		Xend    :   X direction end coordinates
-		Yend    :   Y direction end coordinates
-********************************************************************************/
-void LCD_1IN54_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
-{
-    //set the X coordinates
-    LCD_1IN54_SendCommand(0x2A);
-    LCD_1IN54_SendData_8Bit((Xstart >> 8) & 0xFF);
-    LCD_1IN54_SendData_8Bit(Xstart & 0xFF);
-    LCD_1IN54_SendData_8Bit(((Xend  - 1) >> 8) & 0xFF);
-    LCD_1IN54_SendData_8Bit((Xend  - 1) & 0xFF);
-
-    //set the Y coordinates
-    LCD_1IN54_SendCommand(0x2B);
-    LCD_1IN54_SendData_8Bit((Ystart >> 8) & 0xFF);
-    LCD_1IN54_SendData_8Bit(Ystart & 0xFF);
-    LCD_1IN54_SendData_8Bit(((Yend  - 1) >> 8) & 0xFF);
-    LCD_1IN54_SendData_8Bit((Yend  - 1) & 0xFF);
-
-    LCD_1IN54_SendCommand(0X2C);
-}
-
-/******************************************************************************
-function :	Clear screen
-parameter:
+		Xend    :   X direction end coordinates, exclusive
+		Yend    :   Y direction end coordinates, exclusive
+		Image	:	The whole image
 ******************************************************************************/
-void LCD_1IN54_Clear(UWORD Color)
+void LCD_1IN54_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
 {
-    UWORD j;
-    UWORD Image[LCD_1IN54_WIDTH*LCD_1IN54_HEIGHT];
-    
-    Color = ((Color<<8)&0xff00)|(Color>>8);
-   
-    for (j = 0; j < LCD_1IN54_HEIGHT*LCD_1IN54_WIDTH; j++) {
-        Image[j] = Color;
-    }
-    
-    LCD_1IN54_SetWindows(0, 0, LCD_1IN54_WIDTH, LCD_1IN54_HEIGHT);
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    for(j = 0; j < LCD_1IN54_HEIGHT; j++){
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN54_WIDTH], LCD_1IN54_WIDTH*2);
-    }
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    LCD_Driver_DisplayWindows(&LCD_1IN54_Driver, Xstart, Ystart, Xend, Yend, Image);
 }
 
 /******************************************************************************
-function :	Sends the image buffer in RAM to displays
+function :	Change the color of a point
 parameter:
+		X 		:   X coordinates
+		Y  		:   Y coordinates
+		Color	:	Color
 ******************************************************************************/
-void LCD_1IN54_Display(UWORD *Image)
-{
-    UWORD j;
-    LCD_1IN54_SetWindows(0, 0, LCD_1IN54_WIDTH, LCD_1IN54_HEIGHT);
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    for (j = 0; j < LCD_1IN54_HEIGHT; j++) {
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN54_WIDTH], LCD_1IN54_WIDTH*2);
-    }
-    DEV_Digital_Write(LCD_CS_PIN, 1);
-}
-
-void LCD_1IN54_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
+void LCD_1IN54_DisplayPoint(UWORD X, UWORD Y, UWORD Color)
 {
-    // display
-    UDOUBLE Addr = 0;
-
-    UWORD j;
-    LCD_1IN54_SetWindows(Xstart, Ystart, Xend , Yend);
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    for (j = Ystart; j < Yend - 1; j++) {
-        Addr = Xstart + j * LCD_1IN54_WIDTH ;
-        DEV_SPI_Write_nByte((uint8_t *)&Image[Addr], (Xend-Xstart)*2);
-    }
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    LCD_Driver_Fill(&LCD_1IN54_Driver, X, Y, X + 1, Y + 1, Color);
 }
 
-void LCD_1IN54_DisplayPoint(UWORD X, UWORD Y, UWORD Color)
+void  Handler_1IN54_LCD(int signo)
 {
-    LCD_1IN54_SetWindows(X,Y,X,Y);
-    LCD_1IN54_SendData_16Bit(Color);
+    //System Exit
+    printf("\r\nHandler:Program stop\r\n");     
+    DEV_Module_Exit();
+	exit(0);
 }
-
@@ -2,6 +2,7 @@
 #define __LCD_1IN54_H
 
 #include "DEV_Config.h"
+#include "LCD_Driver.h"
 
 #define LCD_1IN54_HEIGHT 240
 #define LCD_1IN54_WIDTH 240
@@ -19,14 +20,19 @@ typedef struct{
 	UBYTE SCAN_DIR;
 }LCD_1IN54_ATTRIBUTES;
 extern LCD_1IN54_ATTRIBUTES LCD_1IN54;
+extern const LCD_PANEL LCD_1IN54_Panel;
 
 /********************************************************************************
 function:	
 			Macro definition variable name
 ********************************************************************************/
 void LCD_1IN54_Init(UBYTE Scan_dir);
+UDOUBLE LCD_1IN54_Calibrate(void);
+UBYTE LCD_1IN54_UsePIO(void);
 void LCD_1IN54_Clear(UWORD Color);
 void LCD_1IN54_Display(UWORD *Image);
+UBYTE LCD_1IN54_DisplayRects(LCD_STREAM *Stream, LCD_PIO_CHAIN *Chain, const LCD_RECT *Rects, UWORD Count,
+                             UWORD *Image);
 void LCD_1IN54_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
 void LCD_1IN54_DisplayPoint(UWORD X, UWORD Y, UWORD Color);
 
@@ -18,288 +18,147 @@
 #include <stdio.h>
 
 LCD_2IN_ATTRIBUTES LCD_2IN;
+static LCD_DRIVER LCD_2IN_Driver;
+
+/**
+ * Init sequence
+**/
+static const UBYTE LCD_2IN_InitSeq[] = {
+    0x36, 1, 0x00,
+    0x3A, 1, 0x05,
+    0x21, 0,
+    0x2A, 4, 0x00, 0x00, 0x01, 0x3F,
+    0x2B, 4, 0x00, 0x00, 0x00, 0xEF,
+    0xB2, 5, 0x0C, 0x0C, 0x00, 0x33, 0x33,
+    0xB7, 1, 0x35,
+    0xBB, 1, 0x1F,
+    0xC0, 1, 0x2C,
+    0xC2, 1, 0x01,
+    0xC3, 1, 0x12,
+    0xC4, 1, 0x20,
+    0xC6, 1, 0x0F,
+    0xD0, 2, 0xA4, 0xA1,
+    0xE0, 14, 0xD0, 0x08, 0x11, 0x08, 0x0C, 0x15, 0x39, 0x33,
+              0x50, 0x36, 0x13, 0x14, 0x29, 0x2D,
+    0xE1, 14, 0xD0, 0x08, 0x10, 0x08, 0x06, 0x06, 0x39, 0x44,
+              0x51, 0x0B, 0x16, 0x14, 0x2F, 0x31,
+    0x21, 0,
+    0x11, 0,
+    0x29, 0,
+    0x00, LCD_SEQ_END,
+};
+
+/**
+ * Panel descriptor
+**/
+const LCD_PANEL LCD_2IN_Panel = {
+    LCD_2IN_InitSeq,
+    {
+        {LCD_2IN_HEIGHT, LCD_2IN_WIDTH, 0x70, 0, 0},   // HORIZONTAL
+        {LCD_2IN_WIDTH, LCD_2IN_HEIGHT, 0x00, 0, 0},   // VERTICAL
+    },
+    100,
+    LCD_ST7789_BAUD_MAX,
+    LCD_ST7789_BAUD_RATED,
+    LCD_ST7789_LINES,
+};
 
-
-/******************************************************************************
-function :	Hardware reset
+/********************************************************************************
+function :	Initialize the lcd
 parameter:
-******************************************************************************/
-static void LCD_2IN_Reset(void)
+		Scan_dir:   Scan direction
+********************************************************************************/
+void LCD_2IN_Init(UBYTE Scan_dir)
 {
-    DEV_Digital_Write(LCD_RST_PIN, 1);
-    DEV_Delay_ms(100);
-    DEV_Digital_Write(LCD_RST_PIN, 0);
-    DEV_Delay_ms(100);
-    DEV_Digital_Write(LCD_RST_PIN, 1);
-    DEV_Delay_ms(100);
+    DEV_SET_PWM(90);
+    LCD_Driver_Init(&LCD_2IN_Driver, &LCD_2IN_Panel, Scan_dir);
+
+    LCD_2IN.WIDTH = LCD_2IN_Driver.WIDTH;
+    LCD_2IN.HEIGHT = LCD_2IN_Driver.HEIGHT;
+    LCD_2IN.SCAN_DIR = LCD_2IN_Driver.SCAN_DIR;
 }
 
 /******************************************************************************
-function :	send command
-parameter:
-     Reg : Command register
+function :	Raise the SPI clock to the fastest rate the panel takes
+info:
+    See LCD_Driver_Calibrate, returns the rate in Hz.
 ******************************************************************************/
-static void LCD_2IN_SendCommand(UBYTE Reg)
+UDOUBLE LCD_2IN_Calibrate(void)
 {
-    DEV_Digital_Write(LCD_DC_PIN, 0);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Reg);
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    return LCD_Driver_Calibrate(&LCD_2IN_Driver);
 }
 
 /******************************************************************************
-function :	send data
-parameter:
-    Data : Write data
+function :	Move the panel onto the PIO transport
+info:
+    At the rate LCD_2IN_Calibrate found, so calibrate first. Returns 0
+    and stays on the hardware SPI when no state machine or DMA channel is
+    free. The other functions keep working, they borrow the pins.
 ******************************************************************************/
-static void LCD_2IN_SendData_8Bit(UBYTE Data)
+UBYTE LCD_2IN_UsePIO(void)
 {
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Data);
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    return LCD_PIO_Init(LCD_2IN_Driver.Baud);
 }
 
 /******************************************************************************
-function :	send data
+function :	Clear screen
 parameter:
-    Data : Write data
 ******************************************************************************/
-static void LCD_2IN_SendData_16Bit(UWORD Data)
+void LCD_2IN_Clear(UWORD Color)
 {
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    DEV_SPI_WriteByte((Data >> 8) & 0xFF);
-    DEV_SPI_WriteByte(Data & 0xFF);
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    LCD_Driver_Fill(&LCD_2IN_Driver, 0, 0, LCD_2IN.WIDTH, LCD_2IN.HEIGHT, Color);
 }
 
 /******************************************************************************
-function :	Initialize the lcd register
+function :	Sends the image buffer in RAM to displays
 parameter:
 ******************************************************************************/
-static void LCD_2IN_InitReg(void)
-{
-    LCD_2IN_SendCommand(0x36);
-	LCD_2IN_SendData_8Bit(0x00); 
-
-	LCD_2IN_SendCommand(0x3A); 
-	LCD_2IN_SendData_8Bit(0x05);
-
-	LCD_2IN_SendCommand(0x21); 
-
-	LCD_2IN_SendCommand(0x2A);
-	LCD_2IN_SendData_8Bit(0x00);
-	LCD_2IN_SendData_8Bit(0x00);
-	LCD_2IN_SendData_8Bit(0x01);
-	LCD_2IN_SendData_8Bit(0x3F);
-
-	LCD_2IN_SendCommand(0x2B);
-	LCD_2IN_SendData_8Bit(0x00);
-	LCD_2IN_SendData_8Bit(0x00);
-	LCD_2IN_SendData_8Bit(0x00);
-	LCD_2IN_SendData_8Bit(0xEF);
-
-	LCD_2IN_SendCommand(0xB2);
-	LCD_2IN_SendData_8Bit(0x0C);
-	LCD_2IN_SendData_8Bit(0x0C);
-	LCD_2IN_SendData_8Bit(0x00);
-	LCD_2IN_SendData_8Bit(0x33);
-	LCD_2IN_SendData_8Bit(0x33);
-
-	LCD_2IN_SendCommand(0xB7);
-	LCD_2IN_SendData_8Bit(0x35); 
-
-	LCD_2IN_SendCommand(0xBB);
-	LCD_2IN_SendData_8Bit(0x1F);
-
-	LCD_2IN_SendCommand(0xC0);
-	LCD_2IN_SendData_8Bit(0x2C);
-
-	LCD_2IN_SendCommand(0xC2);
-	LCD_2IN_SendData_8Bit(0x01);
-
-	LCD_2IN_SendCommand(0xC3);
-	LCD_2IN_SendData_8Bit(0x12);   
-
-	LCD_2IN_SendCommand(0xC4);
-	LCD_2IN_SendData_8Bit(0x20);
-
-	LCD_2IN_SendCommand(0xC6);
-	LCD_2IN_SendData_8Bit(0x0F); 
-
-	LCD_2IN_SendCommand(0xD0);
-	LCD_2IN_SendData_8Bit(0xA4);
-	LCD_2IN_SendData_8Bit(0xA1);
-
-	LCD_2IN_SendCommand(0xE0);
-	LCD_2IN_SendData_8Bit(0xD0);
-	LCD_2IN_SendData_8Bit(0x08);
-	LCD_2IN_SendData_8Bit(0x11);
-	LCD_2IN_SendData_8Bit(0x08);
-	LCD_2IN_SendData_8Bit(0x0C);
-	LCD_2IN_SendData_8Bit(0x15);
-	LCD_2IN_SendData_8Bit(0x39);
-	LCD_2IN_SendData_8Bit(0x33);
-	LCD_2IN_SendData_8Bit(0x50);
-	LCD_2IN_SendData_8Bit(0x36);
-	LCD_2IN_SendData_8Bit(0x13);
-	LCD_2IN_SendData_8Bit(0x14);
-	LCD_2IN_SendData_8Bit(0x29);
-	LCD_2IN_SendData_8Bit(0x2D);
-
-	LCD_2IN_SendCommand(0xE1);
-	LCD_2IN_SendData_8Bit(0xD0);
-	LCD_2IN_SendData_8Bit(0x08);
-	LCD_2IN_SendData_8Bit(0x10);
-	LCD_2IN_SendData_8Bit(0x08);
-	LCD_2IN_SendData_8Bit(0x06);
-	LCD_2IN_SendData_8Bit(0x06);
-	LCD_2IN_SendData_8Bit(0x39);
-	LCD_2IN_SendData_8Bit(0x44);
-	LCD_2IN_SendData_8Bit(0x51);
-	LCD_2IN_SendData_8Bit(0x0B);
-	LCD_2IN_SendData_8Bit(0x16);
-	LCD_2IN_SendData_8Bit(0x14);
-	LCD_2IN_SendData_8Bit(0x2F);
-	LCD_2IN_SendData_8Bit(0x31);
-	LCD_2IN_SendCommand(0x21);
-
-	LCD_2IN_SendCommand(0x11);
-
-	LCD_2IN_SendCommand(0x29);
-}
-
-/********************************************************************************
-function:	Set the resolution and scanning method of the screen
-parameter:
-		Scan_dir:   Scan direction
-********************************************************************************/
-static void LCD_2IN_SetAttributes(UBYTE Scan_dir)
+void LCD_2IN_Display(UBYTE *Image)
 {
-    //Get the screen scan direction
-    LCD_2IN.SCAN_DIR = Scan_dir;
-    UBYTE MemoryAccessReg = 0x00;
-
-    //Get GRAM and LCD width and height
-    if(Scan_dir == HORIZONTAL) {
-        LCD_2IN.HEIGHT	= LCD_2IN_WIDTH;
-        LCD_2IN.WIDTH   = LCD_2IN_HEIGHT;
-        MemoryAccessReg = 0X70;
-    } else {
-        LCD_2IN.HEIGHT	= LCD_2IN_HEIGHT;       
-        LCD_2IN.WIDTH   = LCD_2IN_WIDTH;
-        MemoryAccessReg = 0X00;
-    }
-
-    // Set the read / write scan direction of the frame memory
-    LCD_2IN_SendCommand(0x36); //MX, MY, RGB mode
-    LCD_2IN_SendData_8Bit(MemoryAccessReg);	//0x08 set RGB
+    LCD_Driver_Display(&LCD_2IN_Driver, (const UWORD *)Image);
 }
 
-/********************************************************************************
-function :	Initialize the lcd
+/******************************************************************************
+function :	Sends windows of the image buffer in the background
 parameter:
-********************************************************************************/
-void LCD_2IN_Init(UBYTE Scan_dir)
+		Stream 	:   At least LCD_WINDOW_WORDS words
+		Chain  	:   At least LCD_CHAIN_MIN blocks
+		Rects  	:   Windows, ends exclusive
+		Count  	:   Number of windows
+		Image	:	The whole image, untouched until LCD_PIO_Busy returns 0
+info:
+    See LCD_Driver_DisplayRectsAsync.
+******************************************************************************/
+UBYTE LCD_2IN_DisplayRects(LCD_STREAM *Stream, LCD_PIO_CHAIN *Chain, const LCD_RECT *Rects, UWORD Count,
+                           UWORD *Image)
 {
-    DEV_SET_PWM(90);
-    //Hardware reset
-    LCD_2IN_Reset();
-
-    //Set the resolution and scanning method of the screen
-    LCD_2IN_SetAttributes(Scan_dir);
-    
-    //Set the initialization register
-    LCD_2IN_InitReg();
+    return LCD_Driver_DisplayRectsAsync(&LCD_2IN_Driver, Stream, Chain, Rects, Count, Image, NULL);
 }
 
-/********************************************************************************
-function:	Sets the start position and size of the display area
+/******************************************************************************
+function :	Sends part of the image buffer in RAM to displays
 parameter:
 		Xstart 	:   X direction Start coordinates
 		Ystart  :   Y direction Start coordinates
-		Xend    :   X direction end coordinates
-		Yend    :   Y direction end coordinates
-********************************************************************************/
-void LCD_2IN_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
-{
-    //set the X coordinates
-    LCD_2IN_SendCommand(0x2A);
-    LCD_2IN_SendData_8Bit(Xstart >>8);
-    LCD_2IN_SendData_8Bit(Xstart & 0xff);
-	LCD_2IN_SendData_8Bit((Xend - 1) >> 8);
-    LCD_2IN_SendData_8Bit((Xend-1) & 0xFF);
-
-    //set the Y coordinates
-    LCD_2IN_SendCommand(0x2B);
-    LCD_2IN_SendData_8Bit(Ystart >>8);
-	LCD_2IN_SendData_8Bit(Ystart & 0xff);
-	LCD_2IN_SendData_8Bit((Yend - 1) >> 8);
-    LCD_2IN_SendData_8Bit((Yend - 1) & 0xff);
-
-    LCD_2IN_SendCommand(0X2C);
-    // printf("%d %d\r\n",x,y);
-}
-
-/******************************************************************************
-function :	Clear screen
-parameter:
+		Xend    :   X direction end coordinates, exclusive
+		Yend    :   Y direction end coordinates, exclusive
+		Image	:	The whole image
 ******************************************************************************/
-void LCD_2IN_Clear(UWORD Color)
+void LCD_2IN_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
 {
-    UWORD i;
-	UWORD image[LCD_2IN_HEIGHT];
-	for(i=0;i<LCD_2IN_HEIGHT;i++){
-		image[i] = Color>>8 | (Color&0xff)<<8;
-	}
-	UBYTE *p = (UBYTE *)(image);
-	LCD_2IN_SetWindows(0, 0, LCD_2IN_HEIGHT,LCD_2IN_WIDTH);
-	DEV_Digital_Write(LCD_DC_PIN, 1);
-	DEV_Digital_Write(LCD_CS_PIN, 0);
-	for(i = 0; i < LCD_2IN_WIDTH; i++){
-		DEV_SPI_Write_nByte(p,LCD_2IN_HEIGHT*2);
-	}
-    DEV_Digital_Write(LCD_CS_PIN, 1);
+    LCD_Driver_DisplayWindows(&LCD_2IN_Driver, Xstart, Ystart, Xend, Yend, Image);
 }
 
 /******************************************************************************
-function :	Sends the image buffer in RAM to displays
+function :	Change the color of a point
 parameter:
+		X 		:   X coordinates
+		Y  		:   Y coordinates
+		Color	:	Color
 ******************************************************************************/
-void LCD_2IN_Display(UBYTE *Image)
-{
-    UWORD j;
-    LCD_2IN_SetWindows(0, 0,LCD_2IN.WIDTH,LCD_2IN.HEIGHT );
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    for (j = 0; j < LCD_2IN.WIDTH; j++) {
-        DEV_SPI_Write_nByte((UBYTE *)Image+LCD_2IN.HEIGHT*2*j,LCD_2IN.HEIGHT*2);
-    }
-    DEV_Digital_Write(LCD_CS_PIN, 1);
-    LCD_2IN_SendCommand(0x29);
-}
-
-void LCD_2IN_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
-{
-    // display
-    UDOUBLE Addr = 0;
-
-    UWORD j;
-    LCD_2IN_SetWindows(Xstart, Ystart, Xend , Yend);
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    DEV_Digital_Write(LCD_CS_PIN, 0);
-    for (j = Ystart; j < Yend - 1; j++) {
-        Addr = Xstart + j * LCD_2IN.WIDTH ;
-        DEV_SPI_Write_nByte((uint8_t *)&Image[Addr], (Xend-Xstart)*2);
-    }
-    DEV_Digital_Write(LCD_CS_PIN, 1);
-}
-
 void LCD_2IN_DisplayPoint(UWORD X, UWORD Y, UWORD Color)
 {
-    LCD_2IN_SetWindows(X,Y,X,Y);
-    LCD_2IN_SendData_16Bit(Color);
+    LCD_Driver_Fill(&LCD_2IN_Driver, X, Y, X + 1, Y + 1, Color);
 }
 
 void  Handler_2IN_LCD(int signo)
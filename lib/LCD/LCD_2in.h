@@ -15,6 +15,7 @@
 #define __LCD_2IN_H
 
 #include "DEV_Config.h"
+#include "LCD_Driver.h"
 #include <stdint.h>
 
 #include <stdlib.h>     //itoa()
@@ -37,14 +38,19 @@ typedef struct{
     UBYTE SCAN_DIR;
 }LCD_2IN_ATTRIBUTES;
 extern LCD_2IN_ATTRIBUTES LCD_2IN;
+extern const LCD_PANEL LCD_2IN_Panel;
 
 /********************************************************************************
 function:	
 			Macro definition variable name
 ********************************************************************************/
 void LCD_2IN_Init(UBYTE Scan_dir);
+UDOUBLE LCD_2IN_Calibrate(void);
+UBYTE LCD_2IN_UsePIO(void);
 void LCD_2IN_Clear(UWORD Color);
 void LCD_2IN_Display(UBYTE *Image);
+UBYTE LCD_2IN_DisplayRects(LCD_STREAM *Stream, LCD_PIO_CHAIN *Chain, const LCD_RECT *Rects, UWORD Count,
+                           UWORD *Image);
 void LCD_2IN_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
 void LCD_2IN_DisplayPoint(UWORD X, UWORD Y, UWORD Color);
 
@@ -0,0 +1,879 @@
+/*****************************************************************************
+* | File      	:   LCD_Driver.c
+* | Function    :   Common driver for the SPI RGB565 LCD panels
+* | Info        :
+*                Window ends are exclusive. Pixels are native RGB565 words,
+*                as Paint keeps them at Scale 65, sent as 16-bit SPI frames
+*                so they go out high byte first without a swap.
+*                Every path but the streams goes out on the hardware SPI and
+*                borrows the pins from the PIO transport when it runs.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#include "LCD_Driver.h"
+#include "Debug.h"
+
+/**
+ * ST7789 init sequence of the 1.14", 1.3" and 1.54" panels
+**/
+const UBYTE LCD_ST7789_Init[] = {
+    0x3A, 1, 0x05,
+    0xB2, 5, 0x0C, 0x0C, 0x00, 0x33, 0x33,
+    0xB7, 1, 0x35,                          // Gate Control
+    0xBB, 1, 0x19,                          // VCOM Setting
+    0xC0, 1, 0x2C,                          // LCM Control
+    0xC2, 1, 0x01,                          // VDV and VRH Command Enable
+    0xC3, 1, 0x12,                          // VRH Set
+    0xC4, 1, 0x20,                          // VDV Set
+    0xC6, 1, 0x0F,                          // Frame Rate Control in Normal Mode
+    0xD0, 2, 0xA4, 0xA1,                    // Power Control 1
+    0xE0, 14, 0xD0, 0x04, 0x0D, 0x11, 0x13, 0x2B, 0x3F,
+              0x54, 0x4C, 0x18, 0x0D, 0x0B, 0x1F, 0x23,   // Positive Voltage Gamma Control
+    0xE1, 14, 0xD0, 0x04, 0x0C, 0x11, 0x13, 0x2C, 0x3F,
+              0x44, 0x51, 0x2F, 0x1F, 0x1F, 0x20, 0x23,   // Negative Voltage Gamma Control
+    0x21, 0,                                // Display Inversion On
+    0x11, 0,                                // Sleep Out
+    0x29, 0,                                // Display On
+    0x00, LCD_SEQ_END,
+};
+
+/**
+ * One row of a fill
+**/
+static UWORD LCD_Driver_Line[LCD_LINE_MAX];
+
+/******************************************************************************
+function :	Send a list of commands, chip select is held by the caller
+parameter:
+    pBurst : Entries in the init sequence format
+    Len    : Length of the list in bytes
+info:
+    DC only toggles at the edges between a command and its parameters.
+    Delay bytes are skipped, waiting is left to the caller.
+******************************************************************************/
+static void LCD_Driver_Burst(const UBYTE *pBurst, UWORD Len)
+{
+    const UBYTE *pEnd = pBurst + Len;
+    UBYTE Count;
+
+    while (pBurst < pEnd)
+    {
+        DEV_Digital_Write(LCD_DC_PIN, 0);
+        DEV_SPI_WriteByte(pBurst[0]);
+        Count = pBurst[1] & ~LCD_SEQ_DELAY;
+        if (Count)
+        {
+            DEV_Digital_Write(LCD_DC_PIN, 1);
+            DEV_SPI_Write_nByte((uint8_t *)pBurst + 2, Count);
+        }
+        pBurst += 2 + Count + ((pBurst[1] & LCD_SEQ_DELAY) ? 1 : 0);
+    }
+}
+
+/******************************************************************************
+function :	Send a list of commands in one chip select
+parameter:
+    Lcd    : Panel
+    pBurst : Entries in the init sequence format
+    Len    : Length of the list in bytes
+******************************************************************************/
+void LCD_Driver_SendBurst(LCD_DRIVER *Lcd, const UBYTE *pBurst, UWORD Len)
+{
+    LCD_PIO_Release();
+    DEV_Digital_Write(LCD_CS_PIN, 0);
+    LCD_Driver_Burst(pBurst, Len);
+    DEV_Digital_Write(LCD_CS_PIN, 1);
+}
+
+/******************************************************************************
+function :	Send a command and its parameters in one chip select
+parameter:
+    Lcd   : Panel
+    Reg   : Command register
+    pData : Parameters, may be NULL when Len is 0
+    Len   : Number of parameters
+******************************************************************************/
+void LCD_Driver_SendCommand(LCD_DRIVER *Lcd, UBYTE Reg, const UBYTE *pData, UWORD Len)
+{
+    LCD_PIO_Release();
+    DEV_Digital_Write(LCD_DC_PIN, 0);
+    DEV_Digital_Write(LCD_CS_PIN, 0);
+    DEV_SPI_WriteByte(Reg);
+    if (Len)
+    {
+        DEV_Digital_Write(LCD_DC_PIN, 1);
+        DEV_SPI_Write_nByte((uint8_t *)pData, Len);
+    }
+    DEV_Digital_Write(LCD_CS_PIN, 1);
+}
+
+/******************************************************************************
+function :	Send an init sequence up to its next delay
+parameter:
+    Lcd   : Panel
+    ppSeq : Position in the byte table, moved past what was sent
+info:
+    The commands up to the delay go out as one burst. Returns the delay,
+    or DEV_TASK_DONE at the end of the table.
+******************************************************************************/
+static UDOUBLE LCD_Driver_SequenceStep(LCD_DRIVER *Lcd, const UBYTE **ppSeq)
+{
+    const UBYTE *pStart = *ppSeq;
+    const UBYTE *pSeq = pStart;
+    UBYTE Count;
+
+    for (;;)
+    {
+        Count = pSeq[1];
+        if (Count == LCD_SEQ_END)
+            break;
+        pSeq += 2 + (Count & ~LCD_SEQ_DELAY);
+        if (Count & LCD_SEQ_DELAY)
+        {
+            LCD_Driver_SendBurst(Lcd, pStart, pSeq + 1 - pStart);
+            *ppSeq = pSeq + 1;
+            return *pSeq;
+        }
+    }
+    if (pSeq > pStart)
+        LCD_Driver_SendBurst(Lcd, pStart, pSeq - pStart);
+    *ppSeq = pSeq;
+    return DEV_TASK_DONE;
+}
+
+/******************************************************************************
+function :	Run an init sequence
+parameter:
+    Lcd  : Panel
+    pSeq : Byte table, see LCD_SEQ_DELAY
+******************************************************************************/
+void LCD_Driver_RunSequence(LCD_DRIVER *Lcd, const UBYTE *pSeq)
+{
+    UDOUBLE Wait;
+
+    while ((Wait = LCD_Driver_SequenceStep(Lcd, &pSeq)) != DEV_TASK_DONE)
+        DEV_Delay_ms(Wait);
+}
+
+/********************************************************************************
+function :	Initialize a panel
+parameter:
+    Lcd      : Driver state to set up
+    Panel    : Panel descriptor
+    Scan_dir : HORIZONTAL or VERTICAL
+info:
+    Waits out the reset and the delays of the init sequence, see
+    LCD_Driver_InitAsync to get on with other work meanwhile.
+********************************************************************************/
+void LCD_Driver_Init(LCD_DRIVER *Lcd, const LCD_PANEL *Panel, UBYTE Scan_dir)
+{
+    UDOUBLE Wait;
+
+    LCD_Driver_InitAsync(Lcd, Panel, Scan_dir);
+    while ((Wait = LCD_Driver_InitStep(Lcd)) != DEV_TASK_DONE)
+        DEV_Delay_ms(Wait);
+}
+
+/********************************************************************************
+function :	Set up a panel without sending anything yet
+parameter:
+    Lcd      : Driver state to set up
+    Panel    : Panel descriptor
+    Scan_dir : HORIZONTAL or VERTICAL
+info:
+    The size is known on return. The reset and init sequence are sent by
+    LCD_Driver_InitStep, e.g. from a DEV_TASK running LCD_Driver_InitTask;
+    draw to the panel only once it has finished.
+********************************************************************************/
+void LCD_Driver_InitAsync(LCD_DRIVER *Lcd, const LCD_PANEL *Panel, UBYTE Scan_dir)
+{
+    Lcd->Panel = Panel;
+    Lcd->SCAN_DIR = (Scan_dir == HORIZONTAL) ? HORIZONTAL : VERTICAL;
+    Lcd->Scan = &Panel->Scan[Lcd->SCAN_DIR];
+    Lcd->WIDTH = Lcd->Scan->Width;
+    Lcd->HEIGHT = Lcd->Scan->Height;
+    Lcd->Baud = DEV_SPI_SetBaud(DEV_SPI_BAUD);
+    Lcd->Init_Step = 0;
+    Lcd->Init_Seq = Panel->Init;
+}
+
+/********************************************************************************
+function :	Next step of the reset and init sequence
+parameter:
+    Lcd : Panel set up by LCD_Driver_InitAsync
+info:
+    Returns the ms to wait before the next step, or DEV_TASK_DONE once the
+    panel is ready. Nothing waits in here.
+********************************************************************************/
+UDOUBLE LCD_Driver_InitStep(LCD_DRIVER *Lcd)
+{
+    if (Lcd->Init_Step < 3)
+    {
+        // reset pulse: high, low, high, each held Reset_ms
+        DEV_Digital_Write(LCD_RST_PIN, Lcd->Init_Step != 1);
+        Lcd->Init_Step++;
+        return Lcd->Panel->Reset_ms;
+    }
+
+    if (Lcd->Init_Step == 3)
+    {
+        // Set the read / write scan direction of the frame memory
+        if (Lcd->Scan->Madctl != LCD_MADCTL_INIT)
+            LCD_Driver_SendCommand(Lcd, 0x36, &Lcd->Scan->Madctl, 1);
+        Lcd->Init_Step++;
+    }
+    return LCD_Driver_SequenceStep(Lcd, &Lcd->Init_Seq);
+}
+
+/********************************************************************************
+function :	DEV_TASK step of a panel init, Task->User is the LCD_DRIVER
+********************************************************************************/
+UDOUBLE LCD_Driver_InitTask(DEV_TASK *Task)
+{
+    return LCD_Driver_InitStep((LCD_DRIVER *)Task->User);
+}
+
+/******************************************************************************
+function :	Write each pattern to COLMOD and check it reads back as expected
+******************************************************************************/
+static UBYTE LCD_Driver_Verify(LCD_DRIVER *Lcd, const UBYTE *Pattern, const UBYTE *Expect, UBYTE Count)
+{
+    UBYTE Try, i, Value;
+
+    for (Try = 0; Try < LCD_CALIBRATE_TRIES; Try++)
+    {
+        for (i = 0; i < Count; i++)
+        {
+            LCD_Driver_SendCommand(Lcd, 0x3A, &Pattern[i], 1);
+            DEV_SPI_Read(0x0C, 0, &Value, 1);
+            if (Value != Expect[i])
+                return 0;
+        }
+    }
+    return 1;
+}
+
+/********************************************************************************
+function :	Find the fastest SPI clock the panel takes
+parameter:
+    Lcd : Panel set up by LCD_Driver_Init
+info:
+    Steps the clock up from DEV_SPI_BAUD to the panel ceiling. At each rate
+    the pixel format register (COLMOD) is written several times at speed
+    and read back slowly on the data line. The first failure ends the
+    search. Values read at DEV_SPI_BAUD are the reference, so the dummy
+    clock and unused bits of each controller do not matter. When the panel
+    cannot be read (RDDID returns all zeros or all ones, or the patterns do
+    not read back distinctly) the datasheet rate Baud_Rated is used instead.
+    The rate found is kept in Lcd->Baud and returned. The PIO transport
+    keeps the clock it was started at, start it with this rate.
+********************************************************************************/
+UDOUBLE LCD_Driver_Calibrate(LCD_DRIVER *Lcd)
+{
+    // 12, 18 then 16 bits per pixel, the last one is what the panel runs at
+    static const UBYTE Pattern[3] = {0x03, 0x06, 0x05};
+    UBYTE Expect[3], Id[3];
+    UDOUBLE Baud, Actual, Last, Best;
+    UBYTE Readable, i;
+
+    LCD_PIO_Release();
+    Best = Last = DEV_SPI_SetBaud(DEV_SPI_BAUD);
+    DEV_SPI_Read(0x04, 1, Id, 3);
+    Readable = (Id[0] | Id[1] | Id[2]) != 0x00 && (Id[0] & Id[1] & Id[2]) != 0xFF;
+    if (Readable)
+    {
+        for (i = 0; i < 3; i++)
+        {
+            LCD_Driver_SendCommand(Lcd, 0x3A, &Pattern[i], 1);
+            DEV_SPI_Read(0x0C, 0, &Expect[i], 1);
+        }
+        Readable = Expect[0] != Expect[1] && Expect[1] != Expect[2] && Expect[0] != Expect[2];
+    }
+    if (!Readable)
+    {
+        Debug("LCD_Driver_Calibrate No read-back, using the rated clock\r\n");
+        Lcd->Baud = DEV_SPI_SetBaud(Lcd->Panel->Baud_Rated);
+        return Lcd->Baud;
+    }
+
+    for (Baud = Last + LCD_BAUD_STEP; Baud <= Lcd->Panel->Baud_Max; Baud += LCD_BAUD_STEP)
+    {
+        Actual = DEV_SPI_SetBaud(Baud);
+        // The divider only gives some rates, skip the repeats
+        if (Actual == Last)
+            continue;
+        Last = Actual;
+        if (!LCD_Driver_Verify(Lcd, Pattern, Expect, 3))
+            break;
+        Best = Actual;
+    }
+
+    // A failed rate may have left COLMOD wrong
+    Lcd->Baud = DEV_SPI_SetBaud(Best);
+    LCD_Driver_SendCommand(Lcd, 0x3A, &Pattern[2], 1);
+    return Lcd->Baud;
+}
+
+/******************************************************************************
+function :	Build the column, row and memory write commands of a window
+******************************************************************************/
+static void LCD_Driver_WindowBurst(LCD_DRIVER *Lcd, UBYTE *pBurst,
+                                   UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    UWORD X0 = Xstart + Lcd->Scan->X_Offset, X1 = Xend - 1 + Lcd->Scan->X_Offset;
+    UWORD Y0 = Ystart + Lcd->Scan->Y_Offset, Y1 = Yend - 1 + Lcd->Scan->Y_Offset;
+
+    pBurst[0] = 0x2A;
+    pBurst[1] = 4;
+    pBurst[2] = X0 >> 8;
+    pBurst[3] = X0;
+    pBurst[4] = X1 >> 8;
+    pBurst[5] = X1;
+    pBurst[6] = 0x2B;
+    pBurst[7] = 4;
+    pBurst[8] = Y0 >> 8;
+    pBurst[9] = Y0;
+    pBurst[10] = Y1 >> 8;
+    pBurst[11] = Y1;
+    pBurst[12] = 0x2C;
+    pBurst[13] = 0;
+}
+
+/********************************************************************************
+function:	Sets the display area and starts a memory write
+parameter:
+		Xstart 	:   X direction Start coordinates
+		Ystart  :   Y direction Start coordinates
+		Xend    :   X direction end coordinates, exclusive
+		Yend    :   Y direction end coordinates, exclusive
+info:
+    The three commands go out in one chip select.
+********************************************************************************/
+void LCD_Driver_SetWindows(LCD_DRIVER *Lcd, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    UBYTE Burst[LCD_WINDOW_BURST];
+
+    LCD_Driver_WindowBurst(Lcd, Burst, Xstart, Ystart, Xend, Yend);
+    LCD_Driver_SendBurst(Lcd, Burst, LCD_WINDOW_BURST);
+}
+
+/******************************************************************************
+function :	Set the display area and keep the panel selected for pixels
+parameter:
+    Lcd    : Panel
+    Xstart, Ystart, Xend, Yend : Window, ends exclusive
+info:
+    Window setup and the pixels that follow share one chip select, which
+    LCD_Driver_EndWindow releases. Pixels are written with
+    DEV_SPI_Write_nWord in between, the pins stay with the SPI until the
+    PIO transport is used again.
+******************************************************************************/
+void LCD_Driver_BeginWindow(LCD_DRIVER *Lcd, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    UBYTE Burst[LCD_WINDOW_BURST];
+
+    LCD_Driver_WindowBurst(Lcd, Burst, Xstart, Ystart, Xend, Yend);
+    LCD_PIO_Release();
+    DEV_Digital_Write(LCD_CS_PIN, 0);
+    LCD_Driver_Burst(Burst, LCD_WINDOW_BURST);
+    DEV_Digital_Write(LCD_DC_PIN, 1);
+}
+
+/******************************************************************************
+function :	End the pixels of LCD_Driver_BeginWindow
+******************************************************************************/
+void LCD_Driver_EndWindow(LCD_DRIVER *Lcd)
+{
+    DEV_Digital_Write(LCD_CS_PIN, 1);
+}
+
+/******************************************************************************
+function :	Send pixels to the window set by LCD_Driver_SetWindows
+parameter:
+    Lcd   : Panel
+    pData : RGB565 pixels
+    Len   : Number of pixels
+******************************************************************************/
+void LCD_Driver_WritePixels(LCD_DRIVER *Lcd, const UWORD *pData, UDOUBLE Len)
+{
+    LCD_PIO_Release();
+    DEV_Digital_Write(LCD_DC_PIN, 1);
+    DEV_Digital_Write(LCD_CS_PIN, 0);
+    DEV_SPI_Write_nWord(pData, Len);
+    DEV_Digital_Write(LCD_CS_PIN, 1);
+}
+
+/******************************************************************************
+function :	Check a window against the panel
+******************************************************************************/
+static UBYTE LCD_Driver_CheckWindow(LCD_DRIVER *Lcd, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    if (Xstart >= Xend || Ystart >= Yend || Xend > Lcd->WIDTH || Yend > Lcd->HEIGHT)
+    {
+        Debug("LCD_Driver Window exceeds the panel\r\n");
+        return 0;
+    }
+    return 1;
+}
+
+/******************************************************************************
+function :	Fill a window with one color
+parameter:
+    Lcd   : Panel
+    Xstart, Ystart, Xend, Yend : Window, ends exclusive
+    Color : RGB565 color
+info:
+    One row is built once and sent for every row of the window.
+******************************************************************************/
+void LCD_Driver_Fill(LCD_DRIVER *Lcd, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    UWORD Width = Xend - Xstart, j;
+
+    if (!LCD_Driver_CheckWindow(Lcd, Xstart, Ystart, Xend, Yend) || Width > LCD_LINE_MAX)
+        return;
+
+    for (j = 0; j < Width; j++)
+        LCD_Driver_Line[j] = Color;
+
+    LCD_Driver_BeginWindow(Lcd, Xstart, Ystart, Xend, Yend);
+    for (j = Ystart; j < Yend; j++)
+        DEV_SPI_Write_nWord(LCD_Driver_Line, Width);
+    LCD_Driver_EndWindow(Lcd);
+}
+
+/******************************************************************************
+function :	Sends the image buffer in RAM to displays
+parameter:
+    Lcd   : Panel
+    Image : WIDTH * HEIGHT pixels, as Paint draws them at Scale 65
+******************************************************************************/
+void LCD_Driver_Display(LCD_DRIVER *Lcd, const UWORD *Image)
+{
+    LCD_Driver_BeginWindow(Lcd, 0, 0, Lcd->WIDTH, Lcd->HEIGHT);
+    DEV_SPI_Write_nWord(Image, (UDOUBLE)Lcd->WIDTH * Lcd->HEIGHT);
+    LCD_Driver_EndWindow(Lcd);
+}
+
+/******************************************************************************
+function :	Sends part of the image buffer in RAM to displays
+parameter:
+    Lcd   : Panel
+    Xstart, Ystart, Xend, Yend : Window, ends exclusive
+    Image : The whole WIDTH * HEIGHT image
+******************************************************************************/
+void LCD_Driver_DisplayWindows(LCD_DRIVER *Lcd, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                               const UWORD *Image)
+{
+    UWORD j;
+
+    if (!LCD_Driver_CheckWindow(Lcd, Xstart, Ystart, Xend, Yend))
+        return;
+
+    LCD_Driver_BeginWindow(Lcd, Xstart, Ystart, Xend, Yend);
+    for (j = Ystart; j < Yend; j++)
+        DEV_SPI_Write_nWord(&Image[Xstart + (UDOUBLE)j * Lcd->WIDTH], Xend - Xstart);
+    LCD_Driver_EndWindow(Lcd);
+}
+
+/******************************************************************************
+function :	Send a list of windows of the image in one stream
+parameter:
+    Lcd    : Panel
+    Stream : Stream the windows are encoded into
+    Rects  : Windows, ends exclusive
+    Count  : Number of windows
+    Image  : The whole WIDTH * HEIGHT image
+info:
+    Each window is its column, row and memory write commands followed by
+    its pixels. The stream is sent whenever it fills up and once at the
+    end, with the PIO transport a whole damage list is one DMA transfer.
+******************************************************************************/
+void LCD_Driver_DisplayRects(LCD_DRIVER *Lcd, LCD_STREAM *Stream, const LCD_RECT *Rects, UWORD Count,
+                             const UWORD *Image)
+{
+    UBYTE Burst[LCD_WINDOW_BURST];
+    const UWORD *pRow;
+    UDOUBLE Left, Sent;
+    UWORD i, j;
+
+    for (i = 0; i < Count; i++)
+    {
+        const LCD_RECT *Rect = &Rects[i];
+        if (!LCD_Driver_CheckWindow(Lcd, Rect->Xstart, Rect->Ystart, Rect->Xend, Rect->Yend))
+            continue;
+
+        LCD_Driver_WindowBurst(Lcd, Burst, Rect->Xstart, Rect->Ystart, Rect->Xend, Rect->Yend);
+        if (!LCD_Stream_Burst(Stream, Burst, LCD_WINDOW_BURST))
+        {
+            LCD_Stream_Send(Stream);
+            if (!LCD_Stream_Burst(Stream, Burst, LCD_WINDOW_BURST))
+            {
+                Debug("LCD_Driver_DisplayRects Stream too small for a window\r\n");
+                return;
+            }
+        }
+
+        for (j = Rect->Ystart; j < Rect->Yend; j++)
+        {
+            pRow = &Image[Rect->Xstart + (UDOUBLE)j * Lcd->WIDTH];
+            for (Left = Rect->Xend - Rect->Xstart; Left; Left -= Sent, pRow += Sent)
+            {
+                Sent = LCD_Stream_Pixels(Stream, pRow, Left);
+                if (Sent < Left)
+                    LCD_Stream_Send(Stream);
+            }
+        }
+    }
+    LCD_Stream_Send(Stream);
+}
+
+/******************************************************************************
+function :	Add the top rows of a window to a DMA chain
+info:
+    The commands and the pixel header are one block of stream words. Rows
+    of a full width window are contiguous in the image and go as one
+    block, other windows take a block per row, as many rows as the chain
+    has room for. Returns the number of rows added, 0 when the stream or
+    the chain is full.
+******************************************************************************/
+static UWORD LCD_Driver_ChainRect(LCD_DRIVER *Lcd, LCD_STREAM *Stream, LCD_PIO_CHAIN *Chain,
+                                  const LCD_RECT *Rect, const UWORD *Image)
+{
+    UBYTE Burst[LCD_WINDOW_BURST];
+    UWORD Width = Rect->Xend - Rect->Xstart, Rows = Rect->Yend - Rect->Ystart, j;
+    UDOUBLE Start = Stream->Count;
+
+    // One words block, the pixel blocks and the null block
+    if (Chain->Count + 3 > Chain->Max)
+        return 0;
+    if (Width != Lcd->WIDTH && Rows > Chain->Max - Chain->Count - 2)
+        Rows = Chain->Max - Chain->Count - 2;
+
+    LCD_Driver_WindowBurst(Lcd, Burst, Rect->Xstart, Rect->Ystart, Rect->Xend, Rect->Ystart + Rows);
+    if (!LCD_Stream_Burst(Stream, Burst, LCD_WINDOW_BURST)
+        || !LCD_Stream_PixelHeader(Stream, (UDOUBLE)Width * Rows))
+    {
+        Stream->Count = Start;
+        return 0;
+    }
+
+    LCD_PIO_ChainWords(Chain, &Stream->Words[Start], Stream->Count - Start);
+    if (Width == Lcd->WIDTH)
+    {
+        LCD_PIO_ChainPixels(Chain, &Image[(UDOUBLE)Rect->Ystart * Lcd->WIDTH], (UDOUBLE)Width * Rows);
+        return Rows;
+    }
+    for (j = Rect->Ystart; j < Rect->Ystart + Rows; j++)
+        LCD_PIO_ChainPixels(Chain, &Image[Rect->Xstart + (UDOUBLE)j * Lcd->WIDTH], Width);
+    return Rows;
+}
+
+/******************************************************************************
+function :	Send a list of windows of the image in the background
+parameter:
+    Lcd    : Panel
+    Stream : Holds the window commands
+    Chain  : Holds the DMA control blocks
+    Rects  : Windows, ends exclusive
+    Count  : Number of windows
+    Image  : The whole WIDTH * HEIGHT image
+    Done   : Called from the DMA interrupt at the end, may be NULL
+info:
+    Returns 1, or 0 when the stream has less than LCD_WINDOW_WORDS or the
+    chain less than LCD_CHAIN_MIN blocks of room; Done is still called
+    then, the windows before the failure may have been sent.
+    The whole batch is one LCD_PIO_Start: pixels go straight from the image
+    and the CPU is free until the completion interrupt. The image, stream
+    and chain must stay untouched until LCD_PIO_Busy returns 0. A batch
+    larger than the stream or the chain goes out in parts, waiting for
+    each but the last.
+    Without the PIO transport the windows are sent at once with
+    LCD_Driver_DisplayRects and Done is called before returning.
+******************************************************************************/
+UBYTE LCD_Driver_DisplayRectsAsync(LCD_DRIVER *Lcd, LCD_STREAM *Stream, LCD_PIO_CHAIN *Chain,
+                                   const LCD_RECT *Rects, UWORD Count, const UWORD *Image, void (*Done)(void))
+{
+    LCD_RECT Band;
+    UWORD i, Rows;
+
+    if (!LCD_PIO_Ready())
+    {
+        LCD_Driver_DisplayRects(Lcd, Stream, Rects, Count, Image);
+        if (Done)
+            Done();
+        return 1;
+    }
+
+    LCD_PIO_Wait();
+    Stream->Count = 0;
+    Chain->Count = 0;
+    for (i = 0; i < Count; i++)
+    {
+        if (!LCD_Driver_CheckWindow(Lcd, Rects[i].Xstart, Rects[i].Ystart, Rects[i].Xend, Rects[i].Yend))
+            continue;
+
+        for (Band = Rects[i]; Band.Ystart < Band.Yend; Band.Ystart += Rows)
+        {
+            Rows = LCD_Driver_ChainRect(Lcd, Stream, Chain, &Band, Image);
+            if (Rows)
+                continue;
+            if (Chain->Count == 0)
+            {
+                Debug("LCD_Driver_DisplayRectsAsync Stream or chain too small\r\n");
+                if (Done)
+                    Done();
+                return 0;
+            }
+
+            // Out of room, send what is there and start over
+            LCD_PIO_Start(Chain, NULL);
+            LCD_PIO_Wait();
+            Stream->Count = 0;
+            Chain->Count = 0;
+        }
+    }
+
+    if (Chain->Count)
+        LCD_PIO_Start(Chain, Done);
+    else if (Done)
+        Done();
+    return 1;
+}
+
+/******************************************************************************
+function :	Memory access control in use
+info:
+    Read from the init sequence when the scan leaves it there.
+******************************************************************************/
+static UBYTE LCD_Driver_Madctl(LCD_DRIVER *Lcd)
+{
+    const UBYTE *pSeq = Lcd->Panel->Init;
+    UBYTE Madctl = Lcd->Scan->Madctl, Count;
+
+    if (Madctl != LCD_MADCTL_INIT)
+        return Madctl;
+    for (; (Count = pSeq[1]) != LCD_SEQ_END; pSeq += 2 + (Count & ~LCD_SEQ_DELAY) + ((Count & LCD_SEQ_DELAY) ? 1 : 0))
+    {
+        if (pSeq[0] == 0x36 && (Count & ~LCD_SEQ_DELAY) == 1)
+            Madctl = pSeq[2];
+    }
+    return Madctl;
+}
+
+/******************************************************************************
+function :	Screen axis the vertical scroll registers move the image along
+info:
+    The controller scrolls its gate lines, which run along X when the scan
+    exchanges rows and columns. Returns HORIZONTAL, VERTICAL, or
+    LCD_SCROLL_NONE when the memory access control is not known.
+******************************************************************************/
+UBYTE LCD_Driver_ScrollAxis(LCD_DRIVER *Lcd)
+{
+    UBYTE Madctl = LCD_Driver_Madctl(Lcd);
+
+    if (Madctl == LCD_MADCTL_INIT || Lcd->Panel->Lines == 0)
+        return LCD_SCROLL_NONE;
+    return (Madctl & 0x20) ? HORIZONTAL : VERTICAL;
+}
+
+/******************************************************************************
+function :	Gate lines of a band along the scroll axis
+parameter:
+    Lcd   : Panel
+    Start : Band on the screen, end exclusive
+    End   :
+    pTop  : First gate line of the band in the order the controller counts
+info:
+    Gate lines run backwards when the scan mirrors them (MY). Returns 0
+    when the panel does not say how its lines run or the band is off them.
+******************************************************************************/
+static UBYTE LCD_Driver_GateBand(LCD_DRIVER *Lcd, UWORD Start, UWORD End, UWORD *pTop)
+{
+    UBYTE Axis = LCD_Driver_ScrollAxis(Lcd);
+    UWORD Top;
+
+    if (Axis == LCD_SCROLL_NONE || Start >= End
+        || End > ((Axis == HORIZONTAL) ? Lcd->WIDTH : Lcd->HEIGHT))
+    {
+        Debug("LCD_Driver No gate lines for this band\r\n");
+        return 0;
+    }
+
+    Top = Start + ((Axis == HORIZONTAL) ? Lcd->Scan->X_Offset : Lcd->Scan->Y_Offset);
+    if (Top + (End - Start) > Lcd->Panel->Lines)
+    {
+        Debug("LCD_Driver Band exceeds the gate lines\r\n");
+        return 0;
+    }
+    if (LCD_Driver_Madctl(Lcd) & 0x80)
+        Top = Lcd->Panel->Lines - Top - (End - Start);
+    *pTop = Top;
+    return 1;
+}
+
+/******************************************************************************
+function :	Scroll a band of the panel
+parameter:
+    Lcd    : Panel
+    Start  : Band along the scroll axis, end exclusive. It spans the whole
+    End      panel across that axis, the lines outside it stay fixed.
+    Offset : Screen position Start + i shows the line written at
+             Start + (i + Offset) % (End - Start)
+info:
+    The band, its fixed areas and the start line go out in one burst, so
+    a ticker can move by sending this and the newly exposed lines. Gate
+    lines run backwards when the scan mirrors them (MY), the offset is
+    turned around to match. Returns 0 when the panel cannot scroll.
+    The band stays in scroll mode until LCD_Driver_ScrollStop.
+******************************************************************************/
+UBYTE LCD_Driver_Scroll(LCD_DRIVER *Lcd, UWORD Start, UWORD End, UWORD Offset)
+{
+    UBYTE Burst[12];
+    UWORD Lines = Lcd->Panel->Lines, Length = End - Start, Top, Line;
+
+    if (!LCD_Driver_GateBand(Lcd, Start, End, &Top))
+        return 0;
+    Offset %= Length;
+    if (LCD_Driver_Madctl(Lcd) & 0x80)
+        Offset = (Length - Offset) % Length;
+    Line = Top + Offset;
+
+    Burst[0] = 0x33;
+    Burst[1] = 6;
+    Burst[2] = Top >> 8;
+    Burst[3] = Top;
+    Burst[4] = Length >> 8;
+    Burst[5] = Length;
+    Burst[6] = (Lines - Top - Length) >> 8;
+    Burst[7] = Lines - Top - Length;
+    Burst[8] = 0x37;
+    Burst[9] = 2;
+    Burst[10] = Line >> 8;
+    Burst[11] = Line;
+    LCD_Driver_SendBurst(Lcd, Burst, sizeof(Burst));
+    return 1;
+}
+
+/******************************************************************************
+function :	Leave scroll mode
+info:
+    Normal display mode ends the scroll. The band then shows the panel
+    memory as written, the caller redraws it.
+******************************************************************************/
+void LCD_Driver_ScrollStop(LCD_DRIVER *Lcd)
+{
+    LCD_Driver_SendCommand(Lcd, 0x13, NULL, 0);
+}
+
+/******************************************************************************
+function :	Enter or leave idle mode
+parameter:
+    Lcd  : Panel
+    Idle : 1 for 8 colours, the top bit of each channel, 0 for full colour
+******************************************************************************/
+void LCD_Driver_Idle(LCD_DRIVER *Lcd, UBYTE Idle)
+{
+    LCD_Driver_SendCommand(Lcd, Idle ? 0x39 : 0x38, NULL, 0);
+}
+
+/******************************************************************************
+function :	Show only a band of the panel
+parameter:
+    Lcd   : Panel
+    Start : Band along LCD_Driver_ScrollAxis, end exclusive. It spans the
+    End     whole panel across that axis.
+info:
+    The gate lines outside the band are not driven, the controller shows
+    them blank. The area and partial mode go out in one burst. Returns 0
+    when the panel cannot do it. LCD_Driver_PartialStop, like
+    LCD_Driver_ScrollStop, returns to normal display mode.
+******************************************************************************/
+UBYTE LCD_Driver_Partial(LCD_DRIVER *Lcd, UWORD Start, UWORD End)
+{
+    UBYTE Burst[8];
+    UWORD Top, Bottom;
+
+    if (!LCD_Driver_GateBand(Lcd, Start, End, &Top))
+        return 0;
+    Bottom = Top + (End - Start) - 1;
+
+    Burst[0] = 0x30;
+    Burst[1] = 4;
+    Burst[2] = Top >> 8;
+    Burst[3] = Top;
+    Burst[4] = Bottom >> 8;
+    Burst[5] = Bottom;
+    Burst[6] = 0x12;
+    Burst[7] = 0;
+    LCD_Driver_SendBurst(Lcd, Burst, sizeof(Burst));
+    return 1;
+}
+
+/******************************************************************************
+function :	Leave partial mode
+info:
+    Normal display mode drives every gate line again. It also ends a scroll.
+******************************************************************************/
+void LCD_Driver_PartialStop(LCD_DRIVER *Lcd)
+{
+    LCD_Driver_SendCommand(Lcd, 0x13, NULL, 0);
+}
+
+/******************************************************************************
+function :	Turn the display off and enter sleep mode
+info:
+    Returns the ms to wait before LCD_Driver_SleepOut. Nothing waits in
+    here.
+******************************************************************************/
+UDOUBLE LCD_Driver_SleepIn(LCD_DRIVER *Lcd)
+{
+    static const UBYTE Off[] = {0x28, 0, 0x10, 0};
+
+    LCD_Driver_SendBurst(Lcd, Off, sizeof(Off));
+    return LCD_SLEEP_IN_MS;
+}
+
+/******************************************************************************
+function :	Leave sleep mode, the display stays off
+info:
+    Returns the ms to wait before LCD_Driver_DisplayOn or
+    LCD_Driver_SleepIn. Nothing waits in here.
+******************************************************************************/
+UDOUBLE LCD_Driver_SleepOut(LCD_DRIVER *Lcd)
+{
+    LCD_Driver_SendCommand(Lcd, 0x11, NULL, 0);
+    return LCD_SLEEP_OUT_MS;
+}
+
+/******************************************************************************
+function :	Turn the display on once the controller is out of sleep
+******************************************************************************/
+void LCD_Driver_DisplayOn(LCD_DRIVER *Lcd)
+{
+    LCD_Driver_SendCommand(Lcd, 0x29, NULL, 0);
+}
+
+/******************************************************************************
+function :	Enter or leave sleep mode
+parameter:
+    Lcd   : Panel
+    Sleep : 1 to turn the panel off and sleep, 0 to wake it and turn it on
+info:
+    Waits out the controller, LCD_Power_Service runs the same steps
+    without waiting.
+******************************************************************************/
+void LCD_Driver_Sleep(LCD_DRIVER *Lcd, UBYTE Sleep)
+{
+    if (Sleep)
+    {
+        DEV_Delay_ms(LCD_Driver_SleepIn(Lcd));
+    }
+    else
+    {
+        DEV_Delay_ms(LCD_Driver_SleepOut(Lcd));
+        LCD_Driver_DisplayOn(Lcd);
+    }
+}
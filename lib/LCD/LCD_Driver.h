@@ -0,0 +1,179 @@
+/*****************************************************************************
+* | File      	:   LCD_Driver.h
+* | Function    :   Common driver for the SPI RGB565 LCD panels
+* | Info        :
+*                Every panel is an LCD_PANEL descriptor: its init sequence
+*                as a byte table, and the size, memory access control and
+*                RAM offset of each scan direction. The LCD_xxx files keep
+*                their own API on top of this one.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#ifndef __LCD_DRIVER_H
+#define __LCD_DRIVER_H
+
+#include "DEV_Config.h"
+#include "LCD_Stream.h"
+#include "LCD_PIO.h"
+
+#define HORIZONTAL 0
+#define VERTICAL   1
+
+/**
+ * Init sequence byte table. Each entry is
+ *     command, count, count data bytes[, delay in ms]
+ * with LCD_SEQ_DELAY set in count when the delay byte is present. The
+ * table ends with an entry whose count is LCD_SEQ_END.
+**/
+#define LCD_SEQ_DELAY   0x80
+#define LCD_SEQ_END     0xFF
+
+/**
+ * LCD_SCAN.Madctl when the init sequence sets the memory access control
+**/
+#define LCD_MADCTL_INIT 0xFF
+
+/**
+ * Length of the column, row and memory write burst of a window
+**/
+#define LCD_WINDOW_BURST 14
+
+/**
+ * Smallest stream and chain LCD_Driver_DisplayRectsAsync takes: the
+ * window burst and pixel header in stream words, and the command, pixel
+ * and null blocks of the chain
+**/
+#define LCD_WINDOW_WORDS    17
+#define LCD_CHAIN_MIN       3
+
+/**
+ * SPI clock of each controller's datasheet write cycle, 16 ns for the
+ * ST7789 and 66 ns for the ST7735S. LCD_Driver_Calibrate uses it when the
+ * panel cannot be read back.
+**/
+#define LCD_ST7789_BAUD_RATED   (62500 * 1000)
+#define LCD_ST7735_BAUD_RATED   (15000 * 1000)
+
+/**
+ * Highest SPI clock LCD_Driver_Calibrate tries. Rates above the rated
+ * one are used only when the read-back check passes at them.
+**/
+#define LCD_ST7789_BAUD_MAX (62500 * 1000)
+#define LCD_ST7735_BAUD_MAX (30000 * 1000)
+
+/**
+ * Gate lines of the controller RAM, the range of the vertical scroll
+ * registers whatever part of it the panel shows
+**/
+#define LCD_ST7789_LINES    320
+#define LCD_ST7735_LINES    162
+
+/**
+ * LCD_Driver_ScrollAxis when the panel cannot scroll
+**/
+#define LCD_SCROLL_NONE     0xFF
+
+/**
+ * Controller waits: after sleep out before sleep in or display on, and
+ * after sleep in before sleep out
+**/
+#define LCD_SLEEP_OUT_MS    120
+#define LCD_SLEEP_IN_MS     5
+
+/**
+ * Calibration step and the checks each rate has to pass
+**/
+#define LCD_BAUD_STEP       (2500 * 1000)
+#define LCD_CALIBRATE_TRIES 8
+
+/**
+ * Widest panel side, the length of the fill row buffer
+**/
+#define LCD_LINE_MAX    320
+
+/**
+ * Panel geometry in one scan direction
+**/
+typedef struct {
+    UWORD Width;
+    UWORD Height;
+    UBYTE Madctl;       // memory access control (0x36)
+    UBYTE X_Offset;     // RAM column of the first visible pixel
+    UBYTE Y_Offset;     // RAM row of the first visible pixel
+} LCD_SCAN;
+
+/**
+ * Panel descriptor
+**/
+typedef struct {
+    const UBYTE *Init;  // init sequence, run after the reset
+    LCD_SCAN Scan[2];   // HORIZONTAL, VERTICAL
+    UBYTE Reset_ms;     // each phase of the reset pulse
+    UDOUBLE Baud_Max;   // SPI clock ceiling, reached only through a read-back check
+    UDOUBLE Baud_Rated; // SPI clock used when the panel cannot be read back
+    UWORD Lines;        // gate lines, LCD_ST7789_LINES or LCD_ST7735_LINES
+} LCD_PANEL;
+
+/**
+ * A panel in use
+**/
+typedef struct {
+    const LCD_PANEL *Panel;
+    const LCD_SCAN *Scan;
+    UWORD WIDTH;
+    UWORD HEIGHT;
+    UBYTE SCAN_DIR;
+    UDOUBLE Baud;       // SPI clock in use
+    UBYTE Init_Step;    // where LCD_Driver_InitStep is
+    const UBYTE *Init_Seq;
+} LCD_DRIVER;
+
+/**
+ * Window on the panel, ends exclusive
+**/
+typedef struct {
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Xend;
+    UWORD Yend;
+} LCD_RECT;
+
+/**
+ * Init sequences shared by several panels
+**/
+extern const UBYTE LCD_ST7789_Init[];
+
+void LCD_Driver_SendBurst(LCD_DRIVER *Lcd, const UBYTE *pBurst, UWORD Len);
+void LCD_Driver_SendCommand(LCD_DRIVER *Lcd, UBYTE Reg, const UBYTE *pData, UWORD Len);
+void LCD_Driver_RunSequence(LCD_DRIVER *Lcd, const UBYTE *pSeq);
+void LCD_Driver_Init(LCD_DRIVER *Lcd, const LCD_PANEL *Panel, UBYTE Scan_dir);
+void LCD_Driver_InitAsync(LCD_DRIVER *Lcd, const LCD_PANEL *Panel, UBYTE Scan_dir);
+UDOUBLE LCD_Driver_InitStep(LCD_DRIVER *Lcd);
+UDOUBLE LCD_Driver_InitTask(DEV_TASK *Task);
+UDOUBLE LCD_Driver_Calibrate(LCD_DRIVER *Lcd);
+void LCD_Driver_SetWindows(LCD_DRIVER *Lcd, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void LCD_Driver_BeginWindow(LCD_DRIVER *Lcd, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void LCD_Driver_EndWindow(LCD_DRIVER *Lcd);
+void LCD_Driver_WritePixels(LCD_DRIVER *Lcd, const UWORD *pData, UDOUBLE Len);
+void LCD_Driver_Fill(LCD_DRIVER *Lcd, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+void LCD_Driver_Display(LCD_DRIVER *Lcd, const UWORD *Image);
+void LCD_Driver_DisplayWindows(LCD_DRIVER *Lcd, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UWORD *Image);
+void LCD_Driver_DisplayRects(LCD_DRIVER *Lcd, LCD_STREAM *Stream, const LCD_RECT *Rects, UWORD Count,
+                             const UWORD *Image);
+UBYTE LCD_Driver_DisplayRectsAsync(LCD_DRIVER *Lcd, LCD_STREAM *Stream, LCD_PIO_CHAIN *Chain,
+                                   const LCD_RECT *Rects, UWORD Count, const UWORD *Image, void (*Done)(void));
+UBYTE LCD_Driver_ScrollAxis(LCD_DRIVER *Lcd);
+UBYTE LCD_Driver_Scroll(LCD_DRIVER *Lcd, UWORD Start, UWORD End, UWORD Offset);
+void LCD_Driver_ScrollStop(LCD_DRIVER *Lcd);
+void LCD_Driver_Idle(LCD_DRIVER *Lcd, UBYTE Idle);
+UBYTE LCD_Driver_Partial(LCD_DRIVER *Lcd, UWORD Start, UWORD End);
+void LCD_Driver_PartialStop(LCD_DRIVER *Lcd);
+UDOUBLE LCD_Driver_SleepIn(LCD_DRIVER *Lcd);
+UDOUBLE LCD_Driver_SleepOut(LCD_DRIVER *Lcd);
+void LCD_Driver_DisplayOn(LCD_DRIVER *Lcd);
+void LCD_Driver_Sleep(LCD_DRIVER *Lcd, UBYTE Sleep);
+
+#endif
@@ -0,0 +1,380 @@
+/*****************************************************************************
+* | File      	:   LCD_PIO.c
+* | Function    :   PIO and DMA transport of LCD word streams
+* | Info        :
+*                The program is in LCD_PIO.pio. One state machine and two
+*                DMA channels are claimed by LCD_PIO_Init and released by
+*                LCD_PIO_Exit: the data channel feeds the state machine,
+*                the control channel reloads it from a block list.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#include "LCD_PIO.h"
+#include "LCD_PIO.pio.h"
+#include "Debug.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+#if LCD_CS_PIN != LCD_DC_PIN + 1
+#error "LCD_PIO sets DC and CS together, LCD_CS_PIN must be LCD_DC_PIN + 1"
+#endif
+
+/**
+ * Clocks the state machine spends per bit
+**/
+#define LCD_PIO_CYCLES_PER_BIT 2
+
+static PIO LCD_PIO_Pio = pio0;
+static int LCD_PIO_Sm = -1;
+static int LCD_PIO_Dma = -1;
+static int LCD_PIO_Ctrl = -1;
+static uint LCD_PIO_Offset;
+static volatile UBYTE LCD_PIO_Running;
+static UBYTE LCD_PIO_Active;     // words went out since the panel was deselected
+static UBYTE LCD_PIO_Pins;       // the state machine drives MOSI, SCK, DC and CS
+static void (*LCD_PIO_Done)(void);
+
+/******************************************************************************
+function :	Interrupt at the null block that ends a chain
+******************************************************************************/
+static void LCD_PIO_Irq(void)
+{
+    if (!dma_channel_get_irq0_status(LCD_PIO_Dma))
+        return;
+    dma_channel_acknowledge_irq0(LCD_PIO_Dma);
+    if (LCD_PIO_Running)
+    {
+        LCD_PIO_Running = 0;
+        if (LCD_PIO_Done)
+            LCD_PIO_Done();
+    }
+}
+
+/******************************************************************************
+function :	Hand MOSI and SCK to the hardware SPI and DC and CS to the CPU
+info:
+    CS is driven high before the CPU takes it, the panel stays deselected.
+******************************************************************************/
+static void LCD_PIO_SpiPins(void)
+{
+    DEV_Digital_Write(LCD_CS_PIN, 1);
+    gpio_set_dir(LCD_CS_PIN, GPIO_OUT);
+    gpio_set_dir(LCD_DC_PIN, GPIO_OUT);
+    gpio_set_function(LCD_CS_PIN, GPIO_FUNC_SIO);
+    gpio_set_function(LCD_DC_PIN, GPIO_FUNC_SIO);
+    gpio_set_function(LCD_CLK_PIN, GPIO_FUNC_SPI);
+    gpio_set_function(LCD_MOSI_PIN, GPIO_FUNC_SPI);
+    LCD_PIO_Pins = 0;
+}
+
+/******************************************************************************
+function :	Give the pins back to the state machine
+info:
+    It idles with CS high and the clock low, as the SPI left them.
+******************************************************************************/
+static void LCD_PIO_TakePins(void)
+{
+    if (LCD_PIO_Pins)
+        return;
+    pio_gpio_init(LCD_PIO_Pio, LCD_MOSI_PIN);
+    pio_gpio_init(LCD_PIO_Pio, LCD_CLK_PIN);
+    pio_gpio_init(LCD_PIO_Pio, LCD_DC_PIN);
+    pio_gpio_init(LCD_PIO_Pio, LCD_CS_PIN);
+    LCD_PIO_Pins = 1;
+}
+
+/******************************************************************************
+function :	Control value of a data channel block
+parameter:
+    Size : DMA_SIZE_32 for stream words, DMA_SIZE_16 for pixels
+info:
+    Every block chains back to the control channel, quietly, so only the
+    null block at the end of the list interrupts.
+******************************************************************************/
+static UDOUBLE LCD_PIO_BlockCtrl(enum dma_channel_transfer_size Size)
+{
+    dma_channel_config c = dma_channel_get_default_config(LCD_PIO_Dma);
+
+    channel_config_set_transfer_data_size(&c, Size);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(LCD_PIO_Pio, LCD_PIO_Sm, true));
+    channel_config_set_chain_to(&c, LCD_PIO_Ctrl);
+    channel_config_set_irq_quiet(&c, true);
+    return channel_config_get_ctrl_value(&c);
+}
+
+/******************************************************************************
+function :	Take the LCD pins over with the PIO program
+parameter:
+    Baud : SPI clock in Hz
+info:
+    Returns 1 when the transport is ready. Returns 0 and leaves the hardware
+    SPI in charge when no state machine, program space or DMA channel is
+    free, so callers can always fall back to DEV_SPI_Write_nByte.
+******************************************************************************/
+UBYTE LCD_PIO_Init(UDOUBLE Baud)
+{
+    float Div;
+
+    if (LCD_PIO_Sm >= 0)
+        return 1;
+
+    if (!pio_can_add_program(LCD_PIO_Pio, &lcd_tagged_program))
+    {
+        Debug("LCD_PIO_Init No room for the program, using SPI\r\n");
+        return 0;
+    }
+    LCD_PIO_Sm = pio_claim_unused_sm(LCD_PIO_Pio, false);
+    if (LCD_PIO_Sm < 0)
+    {
+        Debug("LCD_PIO_Init No free state machine, using SPI\r\n");
+        return 0;
+    }
+    LCD_PIO_Dma = dma_claim_unused_channel(false);
+    LCD_PIO_Ctrl = dma_claim_unused_channel(false);
+    if (LCD_PIO_Dma < 0 || LCD_PIO_Ctrl < 0)
+    {
+        Debug("LCD_PIO_Init No free DMA channel, using SPI\r\n");
+        if (LCD_PIO_Dma >= 0)
+            dma_channel_unclaim(LCD_PIO_Dma);
+        if (LCD_PIO_Ctrl >= 0)
+            dma_channel_unclaim(LCD_PIO_Ctrl);
+        pio_sm_unclaim(LCD_PIO_Pio, LCD_PIO_Sm);
+        LCD_PIO_Sm = LCD_PIO_Dma = LCD_PIO_Ctrl = -1;
+        return 0;
+    }
+    dma_channel_set_irq0_enabled(LCD_PIO_Dma, true);
+    irq_add_shared_handler(DMA_IRQ_0, LCD_PIO_Irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    Div = (float)clock_get_hz(clk_sys) / (LCD_PIO_CYCLES_PER_BIT * Baud);
+    if (Div < 1.0f)
+        Div = 1.0f;
+    LCD_PIO_Offset = pio_add_program(LCD_PIO_Pio, &lcd_tagged_program);
+    lcd_tagged_program_init(LCD_PIO_Pio, LCD_PIO_Sm, LCD_PIO_Offset,
+                            LCD_MOSI_PIN, LCD_CLK_PIN, LCD_DC_PIN, Div);
+    LCD_PIO_Pins = 1;
+    return 1;
+}
+
+/******************************************************************************
+function :	Whether LCD_PIO_Init succeeded
+******************************************************************************/
+UBYTE LCD_PIO_Ready(void)
+{
+    return LCD_PIO_Sm >= 0;
+}
+
+/******************************************************************************
+function :	Wait until the last bit is out, then deselect the panel
+******************************************************************************/
+static void LCD_PIO_WaitIdle(void)
+{
+    UDOUBLE Stall = 1u << (PIO_FDEBUG_TXSTALL_LSB + LCD_PIO_Sm);
+
+    while (!pio_sm_is_tx_fifo_empty(LCD_PIO_Pio, LCD_PIO_Sm))
+        tight_loop_contents();
+    LCD_PIO_Pio->fdebug = Stall;
+    while (!(LCD_PIO_Pio->fdebug & Stall))
+        tight_loop_contents();
+
+    pio_sm_exec(LCD_PIO_Pio, LCD_PIO_Sm, pio_encode_set(pio_pins, 0b11));
+    LCD_PIO_Active = 0;
+}
+
+/******************************************************************************
+function :	Send a word stream
+parameter:
+    pWords : Stream built by the LCD_Stream functions
+    Count  : Number of words
+info:
+    Blocks until the panel is deselected, so the words may be reused.
+******************************************************************************/
+void LCD_PIO_Write(const UDOUBLE *pWords, UDOUBLE Count)
+{
+    dma_channel_config c;
+
+    if (Count == 0)
+        return;
+    LCD_PIO_Wait();
+    LCD_PIO_TakePins();
+
+    c = dma_channel_get_default_config(LCD_PIO_Dma);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(LCD_PIO_Pio, LCD_PIO_Sm, true));
+    LCD_PIO_Active = 1;
+    dma_channel_configure(LCD_PIO_Dma, &c, &LCD_PIO_Pio->txf[LCD_PIO_Sm], pWords, Count, true);
+    dma_channel_wait_for_finish_blocking(LCD_PIO_Dma);
+
+    LCD_PIO_WaitIdle();
+}
+
+/******************************************************************************
+function :	Bind a chain to its block list
+parameter:
+    Chain  : Chain to set up
+    Blocks : Block list, Max entries
+    Max    : Room for blocks, the null block that ends the list included
+******************************************************************************/
+void LCD_PIO_ChainInit(LCD_PIO_CHAIN *Chain, LCD_PIO_BLOCK *Blocks, UWORD Max)
+{
+    Chain->Blocks = Blocks;
+    Chain->Max = Max;
+    Chain->Count = 0;
+}
+
+/******************************************************************************
+function :	Append a block of stream words
+parameter:
+    Chain  : Chain
+    pWords : Words from the LCD_Stream functions, kept until the chain ends
+    Count  : Number of words
+info:
+    Returns 0 when the chain is full.
+******************************************************************************/
+UBYTE LCD_PIO_ChainWords(LCD_PIO_CHAIN *Chain, const UDOUBLE *pWords, UDOUBLE Count)
+{
+    LCD_PIO_BLOCK *Block;
+
+    if (Chain->Count + 1 >= Chain->Max)
+        return 0;
+    Block = &Chain->Blocks[Chain->Count++];
+    Block->Ctrl = LCD_PIO_BlockCtrl(DMA_SIZE_32);
+    Block->Read = pWords;
+    Block->Write = &LCD_PIO_Pio->txf[LCD_PIO_Sm];
+    Block->Count = Count;
+    return 1;
+}
+
+/******************************************************************************
+function :	Append a block of pixels
+parameter:
+    Chain   : Chain
+    pPixels : Native RGB565 pixels, as Paint stores them, kept until the
+              chain ends
+    Count   : Number of pixels
+info:
+    The pixels follow a LCD_Stream_PixelHeader segment. Each one is a
+    16-bit transfer, which the bus copies to both halves of the FIFO word,
+    and the state machine takes the upper half. Returns 0 when the chain is
+    full.
+******************************************************************************/
+UBYTE LCD_PIO_ChainPixels(LCD_PIO_CHAIN *Chain, const UWORD *pPixels, UDOUBLE Count)
+{
+    LCD_PIO_BLOCK *Block;
+
+    if (Chain->Count + 1 >= Chain->Max)
+        return 0;
+    Block = &Chain->Blocks[Chain->Count++];
+    Block->Ctrl = LCD_PIO_BlockCtrl(DMA_SIZE_16);
+    Block->Read = pPixels;
+    Block->Write = &LCD_PIO_Pio->txf[LCD_PIO_Sm];
+    Block->Count = Count;
+    return 1;
+}
+
+/******************************************************************************
+function :	Run a chain in the background
+parameter:
+    Chain : Blocks from LCD_PIO_ChainWords and LCD_PIO_ChainPixels
+    Done  : Called from the DMA interrupt when the last block has been
+            queued, may be NULL
+info:
+    One start call, the control channel loads each block into the data
+    channel, which chains back to it when the block is done. The null block
+    ends the list with the only interrupt. The chain, its words and pixels
+    must stay untouched until LCD_PIO_Busy returns 0.
+******************************************************************************/
+void LCD_PIO_Start(LCD_PIO_CHAIN *Chain, void (*Done)(void))
+{
+    dma_channel_config c;
+    LCD_PIO_BLOCK *Null;
+
+    LCD_PIO_Wait();
+    if (Chain->Count == 0)
+        return;
+    LCD_PIO_TakePins();
+
+    // A zero count written to the trigger register is a null trigger
+    Null = &Chain->Blocks[Chain->Count];
+    Null->Ctrl = LCD_PIO_BlockCtrl(DMA_SIZE_32);
+    Null->Read = NULL;
+    Null->Write = NULL;
+    Null->Count = 0;
+
+    // Each control transfer writes CTRL, READ_ADDR, WRITE_ADDR and
+    // TRANS_COUNT_TRIG of the data channel, wrapping on 16 bytes
+    c = dma_channel_get_default_config(LCD_PIO_Ctrl);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, 4);
+
+    LCD_PIO_Done = Done;
+    LCD_PIO_Running = 1;
+    LCD_PIO_Active = 1;
+    dma_channel_configure(LCD_PIO_Ctrl, &c, &dma_hw->ch[LCD_PIO_Dma].al1_ctrl, Chain->Blocks, 4, true);
+}
+
+/******************************************************************************
+function :	Whether a chain is still being queued
+******************************************************************************/
+UBYTE LCD_PIO_Busy(void)
+{
+    return LCD_PIO_Running;
+}
+
+/******************************************************************************
+function :	Wait for a chain to finish and deselect the panel
+******************************************************************************/
+void LCD_PIO_Wait(void)
+{
+    if (LCD_PIO_Sm < 0)
+        return;
+    while (LCD_PIO_Running)
+        tight_loop_contents();
+    if (LCD_PIO_Active)
+        LCD_PIO_WaitIdle();
+}
+
+/******************************************************************************
+function :	Lend the pins to the hardware SPI
+info:
+    Waits for a chain in flight first. The driver calls it before each
+    transfer it makes on the SPI, the next LCD_PIO_Write or LCD_PIO_Start
+    takes the pins back. Does nothing without the transport or when the
+    pins are already lent.
+******************************************************************************/
+void LCD_PIO_Release(void)
+{
+    if (LCD_PIO_Sm < 0 || !LCD_PIO_Pins)
+        return;
+    LCD_PIO_Wait();
+    LCD_PIO_SpiPins();
+}
+
+/******************************************************************************
+function :	Release the state machine and hand the pins back to SPI
+******************************************************************************/
+void LCD_PIO_Exit(void)
+{
+    if (LCD_PIO_Sm < 0)
+        return;
+
+    LCD_PIO_Wait();
+    irq_remove_handler(DMA_IRQ_0, LCD_PIO_Irq);
+    dma_channel_set_irq0_enabled(LCD_PIO_Dma, false);
+    pio_sm_set_enabled(LCD_PIO_Pio, LCD_PIO_Sm, false);
+    pio_remove_program(LCD_PIO_Pio, &lcd_tagged_program, LCD_PIO_Offset);
+    pio_sm_unclaim(LCD_PIO_Pio, LCD_PIO_Sm);
+    dma_channel_unclaim(LCD_PIO_Dma);
+    dma_channel_unclaim(LCD_PIO_Ctrl);
+    LCD_PIO_Sm = LCD_PIO_Dma = LCD_PIO_Ctrl = -1;
+    LCD_PIO_SpiPins();
+}
@@ -0,0 +1,58 @@
+/*****************************************************************************
+* | File      	:   LCD_PIO.h
+* | Function    :   PIO and DMA transport of LCD word streams
+* | Info        :
+*                A PIO state machine clocks out a tagged word stream
+*                (LCD_Stream.h) with DC carried in the stream, fed by one
+*                DMA channel, so a list of windows and their pixels goes out
+*                without the CPU toggling DC. A chain of DMA control blocks
+*                sends windows straight from the image in the background.
+*                Pins: the state machine owns MOSI, SCK, DC and CS from
+*                LCD_PIO_Init on. The driver's SPI paths call
+*                LCD_PIO_Release to borrow them back, the next
+*                LCD_PIO_Write or LCD_PIO_Start takes them again, and
+*                LCD_PIO_Exit returns them for good.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#ifndef __LCD_PIO_H
+#define __LCD_PIO_H
+
+#include "DEV_Config.h"
+
+/**
+ * One DMA control block, laid out as the data channel's CTRL, READ_ADDR,
+ * WRITE_ADDR and TRANS_COUNT_TRIG alias
+**/
+typedef struct {
+    UDOUBLE Ctrl;
+    const void *Read;
+    volatile void *Write;
+    UDOUBLE Count;
+} LCD_PIO_BLOCK;
+
+/**
+ * Block list run by one LCD_PIO_Start
+**/
+typedef struct {
+    LCD_PIO_BLOCK *Blocks;
+    UWORD Max;          // room in Blocks, one is kept for the end
+    UWORD Count;        // blocks in use
+} LCD_PIO_CHAIN;
+
+UBYTE LCD_PIO_Init(UDOUBLE Baud);
+UBYTE LCD_PIO_Ready(void);
+void LCD_PIO_Write(const UDOUBLE *pWords, UDOUBLE Count);
+void LCD_PIO_ChainInit(LCD_PIO_CHAIN *Chain, LCD_PIO_BLOCK *Blocks, UWORD Max);
+UBYTE LCD_PIO_ChainWords(LCD_PIO_CHAIN *Chain, const UDOUBLE *pWords, UDOUBLE Count);
+UBYTE LCD_PIO_ChainPixels(LCD_PIO_CHAIN *Chain, const UWORD *pPixels, UDOUBLE Count);
+void LCD_PIO_Start(LCD_PIO_CHAIN *Chain, void (*Done)(void));
+UBYTE LCD_PIO_Busy(void);
+void LCD_PIO_Wait(void);
+void LCD_PIO_Release(void);
+void LCD_PIO_Exit(void);
+
+#endif
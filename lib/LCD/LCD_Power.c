@@ -0,0 +1,231 @@
+/*****************************************************************************
+* | File      	:   LCD_Power.c
+* | Function    :   Low power modes of an LCD panel and its backlight
+* | Info        :
+*                Sleep goes backlight fade out, display off and sleep in;
+*                waking goes sleep out, display on once the controller has
+*                settled, and backlight fade in. Service moves one step at
+*                a time and never waits.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#include "LCD_Power.h"
+#include "Debug.h"
+
+const LCD_POWER_CURRENT LCD_ST7789_Current = {
+    .Normal_uA = 6500,
+    .Idle_uA = 4000,
+    .Partial_uA = 2500,
+    .Sleep_uA = 20,
+    .Backlight_uA = 22000,
+};
+
+const LCD_POWER_CURRENT LCD_ST7735_Current = {
+    .Normal_uA = 4000,
+    .Idle_uA = 2500,
+    .Partial_uA = 1500,
+    .Sleep_uA = 10,
+    .Backlight_uA = 15000,
+};
+
+/******************************************************************************
+function :	Take a panel under power management
+parameter:
+    Power     : Power manager
+    Lcd       : Panel, awake after LCD_Driver_Init
+    Current   : Current figures of the module, LCD_ST7789_Current or
+                LCD_ST7735_Current
+    Backlight : Backlight level while awake, 0~100
+    Fade_ms   : Length of the backlight fades
+info:
+    The panel starts in normal mode and the backlight fades in.
+******************************************************************************/
+void LCD_Power_Init(LCD_POWER *Power, LCD_DRIVER *Lcd, const LCD_POWER_CURRENT *Current,
+                    UBYTE Backlight, UWORD Fade_ms)
+{
+    Power->Lcd = Lcd;
+    Power->Current = Current;
+    Power->Mode = LCD_POWER_NORMAL;
+    Power->Start = Power->End = 0;
+    Power->Backlight = Backlight;
+    Power->Fade_ms = Fade_ms;
+    Power->Sleep = 0;
+    Power->State = LCD_POWER_AWAKE;
+    Power->Wait_ms = LCD_SLEEP_OUT_MS;
+    Power->Mark_ms = 0 - LCD_SLEEP_OUT_MS; // the init sequence has settled
+    DEV_PWM_Fade(Backlight, Fade_ms);
+}
+
+/******************************************************************************
+function :	Choose the display mode
+parameter:
+    Power : Power manager
+    Mode  : LCD_POWER_NORMAL, or LCD_POWER_IDLE and LCD_POWER_PARTIAL
+    Start : Band shown in partial mode, along LCD_Driver_ScrollAxis, end
+    End     exclusive, e.g. the rows of the clock digits
+info:
+    Only the commands for what changed are sent, also while asleep so the
+    panel wakes in the new mode. Returns 0, with the mode unchanged, when
+    the panel has no partial mode for the band.
+******************************************************************************/
+UBYTE LCD_Power_SetMode(LCD_POWER *Power, UBYTE Mode, UWORD Start, UWORD End)
+{
+    Mode &= LCD_POWER_IDLE | LCD_POWER_PARTIAL;
+
+    if (Mode & LCD_POWER_PARTIAL)
+    {
+        if (!(Power->Mode & LCD_POWER_PARTIAL) || Start != Power->Start || End != Power->End)
+        {
+            if (!LCD_Driver_Partial(Power->Lcd, Start, End))
+                return 0;
+            Power->Start = Start;
+            Power->End = End;
+        }
+    }
+    else if (Power->Mode & LCD_POWER_PARTIAL)
+    {
+        LCD_Driver_PartialStop(Power->Lcd);
+    }
+
+    if ((Mode ^ Power->Mode) & LCD_POWER_IDLE)
+        LCD_Driver_Idle(Power->Lcd, Mode & LCD_POWER_IDLE);
+    Power->Mode = Mode;
+    return 1;
+}
+
+/******************************************************************************
+function :	Set the backlight level while awake
+parameter:
+    Power     : Power manager
+    Backlight : 0~100, faded to when awake
+******************************************************************************/
+void LCD_Power_SetBacklight(LCD_POWER *Power, UBYTE Backlight)
+{
+    if (Backlight > 100)
+    {
+        Debug("LCD_Power_SetBacklight Level exceeds 100\r\n");
+        return;
+    }
+    Power->Backlight = Backlight;
+    if (Power->State == LCD_POWER_AWAKE && !Power->Sleep)
+        DEV_PWM_Fade(Backlight, Power->Fade_ms);
+}
+
+/******************************************************************************
+function :	Ask for sleep or wake
+parameter:
+    Power : Power manager
+    Sleep : 1 to sleep, 0 to wake
+info:
+    Nothing is sent here, LCD_Power_Service carries it out. A request made
+    half way is turned around from where the panel is.
+******************************************************************************/
+void LCD_Power_Sleep(LCD_POWER *Power, UBYTE Sleep)
+{
+    Power->Sleep = Sleep ? 1 : 0;
+}
+
+/******************************************************************************
+function :	Move the panel towards the requested state
+parameter:
+    Power  : Power manager
+    Now_ms : Current time, e.g. to_ms_since_boot(get_absolute_time())
+info:
+    Call it from the main loop. The panel can be drawn to whenever it
+    returns LCD_POWER_AWAKE; in the other states it keeps its memory and
+    shows it after waking.
+******************************************************************************/
+LCD_POWER_STATE LCD_Power_Service(LCD_POWER *Power, UDOUBLE Now_ms)
+{
+    switch (Power->State)
+    {
+    case LCD_POWER_AWAKE:
+        if (Power->Sleep)
+        {
+            DEV_PWM_Fade(0, Power->Fade_ms);
+            Power->State = LCD_POWER_DIMMING;
+        }
+        break;
+
+    case LCD_POWER_DIMMING:
+        if (!Power->Sleep)
+        {
+            DEV_PWM_Fade(Power->Backlight, Power->Fade_ms);
+            Power->State = LCD_POWER_AWAKE;
+        }
+        else if (!DEV_PWM_Fading() && Now_ms - Power->Mark_ms >= Power->Wait_ms)
+        {
+            Power->Wait_ms = LCD_Driver_SleepIn(Power->Lcd);
+            Power->Mark_ms = Now_ms;
+            Power->State = LCD_POWER_ASLEEP;
+        }
+        break;
+
+    case LCD_POWER_ASLEEP:
+        if (!Power->Sleep && Now_ms - Power->Mark_ms >= Power->Wait_ms)
+        {
+            Power->Wait_ms = LCD_Driver_SleepOut(Power->Lcd);
+            Power->Mark_ms = Now_ms;
+            Power->State = LCD_POWER_WAKING;
+        }
+        break;
+
+    case LCD_POWER_WAKING:
+        if (Now_ms - Power->Mark_ms < Power->Wait_ms)
+            break;
+        if (Power->Sleep)
+        {
+            // backlight is still off, the next call sleeps again
+            Power->State = LCD_POWER_DIMMING;
+            break;
+        }
+        LCD_Driver_DisplayOn(Power->Lcd);
+        DEV_PWM_Fade(Power->Backlight, Power->Fade_ms);
+        Power->State = LCD_POWER_AWAKE;
+        break;
+    }
+    return Power->State;
+}
+
+/******************************************************************************
+function :	Current estimate of a mode
+parameter:
+    Power     : Power manager, its partial band is used
+    Mode      : LCD_POWER_NORMAL, LCD_POWER_IDLE, LCD_POWER_PARTIAL or
+                LCD_POWER_SLEEP
+    Backlight : Backlight level, 0~100, not counted asleep
+info:
+    Returns microamps. Partial mode is its own figure plus the mode's share
+    for the lines driven.
+******************************************************************************/
+UDOUBLE LCD_Power_Estimate(LCD_POWER *Power, UBYTE Mode, UBYTE Backlight)
+{
+    const LCD_POWER_CURRENT *Current = Power->Current;
+    UDOUBLE Panel;
+
+    if (Mode & LCD_POWER_SLEEP)
+        return Current->Sleep_uA;
+
+    Panel = (Mode & LCD_POWER_IDLE) ? Current->Idle_uA : Current->Normal_uA;
+    if ((Mode & LCD_POWER_PARTIAL) && Panel > Current->Partial_uA)
+    {
+        UWORD Lines = (LCD_Driver_ScrollAxis(Power->Lcd) == HORIZONTAL) ? Power->Lcd->WIDTH : Power->Lcd->HEIGHT;
+        Panel = Current->Partial_uA + (Panel - Current->Partial_uA) * (Power->End - Power->Start) / Lines;
+    }
+    return Panel + Current->Backlight_uA * Backlight / 100;
+}
+
+/******************************************************************************
+function :	Current estimate of the panel as it is now
+info:
+    Returns microamps, with the backlight at its present level.
+******************************************************************************/
+UDOUBLE LCD_Power_Current(LCD_POWER *Power)
+{
+    if (Power->State == LCD_POWER_ASLEEP)
+        return LCD_Power_Estimate(Power, LCD_POWER_SLEEP, 0);
+    return LCD_Power_Estimate(Power, Power->Mode, DEV_PWM_Level());
+}
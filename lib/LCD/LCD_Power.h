@@ -0,0 +1,82 @@
+/*****************************************************************************
+* | File      	:   LCD_Power.h
+* | Function    :   Low power modes of an LCD panel and its backlight
+* | Info        :
+*                Idle (8 colour) and partial display modes, sleep in and out
+*                requested by the app and carried out by LCD_Power_Service
+*                without blocking, and backlight fades run by a timer. Each
+*                state has a current estimate for battery budgets.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#ifndef __LCD_POWER_H
+#define __LCD_POWER_H
+
+#include "LCD_Driver.h"
+
+/**
+ * Mode bits, LCD_POWER_SLEEP only for LCD_Power_Estimate
+**/
+#define LCD_POWER_NORMAL    0x00
+#define LCD_POWER_IDLE      0x01
+#define LCD_POWER_PARTIAL   0x02
+#define LCD_POWER_SLEEP     0x04
+
+/**
+ * Supply current of a panel module in microamps
+**/
+typedef struct {
+    UDOUBLE Normal_uA;      // full colour, every line driven
+    UDOUBLE Idle_uA;        // 8 colours
+    UDOUBLE Partial_uA;     // partial mode with no line driven, scales up with the band
+    UDOUBLE Sleep_uA;
+    UDOUBLE Backlight_uA;   // backlight at 100
+} LCD_POWER_CURRENT;
+
+/**
+ * Typical figures for the Pico LCD modules, measure a board for a real
+ * budget
+**/
+extern const LCD_POWER_CURRENT LCD_ST7789_Current;
+extern const LCD_POWER_CURRENT LCD_ST7735_Current;
+
+/**
+ * Where the panel is on its way in or out of sleep
+**/
+typedef enum {
+    LCD_POWER_AWAKE = 0,
+    LCD_POWER_DIMMING,      // backlight fading out before sleep in
+    LCD_POWER_ASLEEP,
+    LCD_POWER_WAKING,       // sleep out sent, display on when it settles
+} LCD_POWER_STATE;
+
+/**
+ * A panel under power management
+**/
+typedef struct {
+    LCD_DRIVER *Lcd;
+    const LCD_POWER_CURRENT *Current;
+    UBYTE Mode;             // LCD_POWER_IDLE, LCD_POWER_PARTIAL
+    UWORD Start;            // partial band along LCD_Driver_ScrollAxis, end exclusive
+    UWORD End;
+    UBYTE Backlight;        // level while awake, 0~100
+    UWORD Fade_ms;
+    UBYTE Sleep;            // requested by the app
+    LCD_POWER_STATE State;
+    UDOUBLE Mark_ms;        // last sleep in or sleep out
+    UDOUBLE Wait_ms;        // the controller wait it asked for
+} LCD_POWER;
+
+void LCD_Power_Init(LCD_POWER *Power, LCD_DRIVER *Lcd, const LCD_POWER_CURRENT *Current,
+                    UBYTE Backlight, UWORD Fade_ms);
+UBYTE LCD_Power_SetMode(LCD_POWER *Power, UBYTE Mode, UWORD Start, UWORD End);
+void LCD_Power_SetBacklight(LCD_POWER *Power, UBYTE Backlight);
+void LCD_Power_Sleep(LCD_POWER *Power, UBYTE Sleep);
+LCD_POWER_STATE LCD_Power_Service(LCD_POWER *Power, UDOUBLE Now_ms);
+UDOUBLE LCD_Power_Estimate(LCD_POWER *Power, UBYTE Mode, UBYTE Backlight);
+UDOUBLE LCD_Power_Current(LCD_POWER *Power);
+
+#endif
@@ -0,0 +1,194 @@
+/*****************************************************************************
+* | File      	:   LCD_Stream.c
+* | Function    :   Tagged word streams of LCD commands and pixels
+* | Info        :
+*                The encoders append whole segments or nothing, except
+*                LCD_Stream_Pixels which appends as many pixels as fit: a
+*                memory write continues across data segments, so a caller
+*                sends the stream and carries on with the rest.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#include "LCD_Stream.h"
+#include "LCD_PIO.h"
+#include "LCD_Driver.h"
+
+/**
+ * Bytes gathered per write when a stream goes out over SPI
+**/
+#define LCD_STREAM_SPI_CHUNK 64
+
+/******************************************************************************
+function :	Bind a stream to its word buffer
+parameter:
+    Stream : Stream to set up
+    Words  : Buffer, Max words
+    Max    : Room for words
+******************************************************************************/
+void LCD_Stream_Init(LCD_STREAM *Stream, UDOUBLE *Words, UDOUBLE Max)
+{
+    Stream->Words = Words;
+    Stream->Max = Max;
+    Stream->Count = 0;
+}
+
+/******************************************************************************
+function :	Append a command and its parameters
+parameter:
+    Stream : Stream
+    Reg    : Command register
+    pData  : Parameters, may be NULL when Len is 0
+    Len    : Number of parameters
+info:
+    Returns 0 and appends nothing when the stream has no room.
+******************************************************************************/
+UBYTE LCD_Stream_Command(LCD_STREAM *Stream, UBYTE Reg, const UBYTE *pData, UWORD Len)
+{
+    UDOUBLE *pWord;
+    UWORD i;
+
+    if (Stream->Count + 2 + (Len ? Len + 1 : 0) > Stream->Max)
+        return 0;
+
+    pWord = &Stream->Words[Stream->Count];
+    *pWord++ = LCD_STREAM_HEADER(0, 0, 1);
+    *pWord++ = (UDOUBLE)Reg << 24;
+    if (Len)
+    {
+        *pWord++ = LCD_STREAM_HEADER(1, 0, Len);
+        for (i = 0; i < Len; i++)
+            *pWord++ = (UDOUBLE)pData[i] << 24;
+    }
+    Stream->Count = pWord - Stream->Words;
+    return 1;
+}
+
+/******************************************************************************
+function :	Append a list of commands in the init sequence format
+parameter:
+    Stream : Stream
+    pBurst : Entries of command, count, count parameters
+    Len    : Length of the list in bytes
+info:
+    Delay bytes are skipped. Returns 0 and appends nothing when the list
+    does not fit.
+******************************************************************************/
+UBYTE LCD_Stream_Burst(LCD_STREAM *Stream, const UBYTE *pBurst, UWORD Len)
+{
+    const UBYTE *pEnd = pBurst + Len;
+    UDOUBLE Start = Stream->Count;
+    UBYTE Count;
+
+    while (pBurst < pEnd)
+    {
+        Count = pBurst[1] & ~LCD_SEQ_DELAY;
+        if (!LCD_Stream_Command(Stream, pBurst[0], pBurst + 2, Count))
+        {
+            Stream->Count = Start;
+            return 0;
+        }
+        pBurst += 2 + Count + ((pBurst[1] & LCD_SEQ_DELAY) ? 1 : 0);
+    }
+    return 1;
+}
+
+/******************************************************************************
+function :	Append the header of pixels sent separately
+parameter:
+    Stream : Stream
+    Count  : Number of pixels that follow the stream
+info:
+    For pixels a DMA chain sends straight from the image. Returns 0 when
+    the stream has no room.
+******************************************************************************/
+UBYTE LCD_Stream_PixelHeader(LCD_STREAM *Stream, UDOUBLE Count)
+{
+    if (Stream->Count + 1 > Stream->Max)
+        return 0;
+    Stream->Words[Stream->Count++] = LCD_STREAM_HEADER(1, 1, Count);
+    return 1;
+}
+
+/******************************************************************************
+function :	Append pixel data
+parameter:
+    Stream  : Stream
+    pPixels : RGB565 pixels, native words as Paint stores them
+    Count   : Number of pixels
+info:
+    Returns the number of pixels appended, fewer than Count when the stream
+    fills up.
+******************************************************************************/
+UDOUBLE LCD_Stream_Pixels(LCD_STREAM *Stream, const UWORD *pPixels, UDOUBLE Count)
+{
+    UDOUBLE *pWord;
+    UDOUBLE i;
+
+    if (Stream->Count + 1 >= Stream->Max || Count == 0)
+        return 0;
+    if (Count > Stream->Max - Stream->Count - 1)
+        Count = Stream->Max - Stream->Count - 1;
+
+    pWord = &Stream->Words[Stream->Count];
+    *pWord++ = LCD_STREAM_HEADER(1, 1, Count);
+    for (i = 0; i < Count; i++)
+        *pWord++ = (UDOUBLE)pPixels[i] << 16;
+    Stream->Count = pWord - Stream->Words;
+    return Count;
+}
+
+/******************************************************************************
+function :	Decode a stream onto the hardware SPI
+******************************************************************************/
+static void LCD_Stream_SendSPI(const UDOUBLE *pWords, UDOUBLE Count)
+{
+    UBYTE Chunk[LCD_STREAM_SPI_CHUNK];
+    const UDOUBLE *pEnd = pWords + Count;
+    UDOUBLE Header, Units;
+    UWORD Len = 0;
+
+    DEV_Digital_Write(LCD_CS_PIN, 0);
+    while (pWords < pEnd)
+    {
+        Header = *pWords++;
+        Units = (Header & LCD_STREAM_COUNT) + 1;
+        DEV_Digital_Write(LCD_DC_PIN, (Header & LCD_STREAM_DC) ? 1 : 0);
+
+        for (; Units && pWords < pEnd; Units--, pWords++)
+        {
+            Chunk[Len++] = *pWords >> 24;
+            if (Header & LCD_STREAM_WIDE)
+                Chunk[Len++] = *pWords >> 16;
+            if (Len > LCD_STREAM_SPI_CHUNK - 2)
+            {
+                DEV_SPI_Write_nByte(Chunk, Len);
+                Len = 0;
+            }
+        }
+        // DC changes with the next header, flush under the current one
+        if (Len)
+        {
+            DEV_SPI_Write_nByte(Chunk, Len);
+            Len = 0;
+        }
+    }
+    DEV_Digital_Write(LCD_CS_PIN, 1);
+}
+
+/******************************************************************************
+function :	Send a stream and empty it
+info:
+    Goes through the PIO transport when LCD_PIO_Init succeeded, otherwise
+    through the hardware SPI.
+******************************************************************************/
+void LCD_Stream_Send(LCD_STREAM *Stream)
+{
+    if (LCD_PIO_Ready())
+        LCD_PIO_Write(Stream->Words, Stream->Count);
+    else
+        LCD_Stream_SendSPI(Stream->Words, Stream->Count);
+    Stream->Count = 0;
+}
@@ -0,0 +1,47 @@
+/*****************************************************************************
+* | File      	:   LCD_Stream.h
+* | Function    :   Tagged word streams of LCD commands and pixels
+* | Info        :
+*                A stream is a list of segments. A segment is a header word
+*                followed by one word per unit:
+*                    header  bit 31      DC
+*                            bit 30      LCD_STREAM_WIDE, 16-bit units
+*                            bits 29..0  units - 1
+*                    unit    byte in bits 31..24, pixel in bits 31..16
+*                LCD_PIO.pio clocks it out with no CPU help. Without the PIO
+*                transport the same stream is decoded onto the hardware SPI.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#ifndef __LCD_STREAM_H
+#define __LCD_STREAM_H
+
+#include "DEV_Config.h"
+
+#define LCD_STREAM_DC       0x80000000u
+#define LCD_STREAM_WIDE     0x40000000u
+#define LCD_STREAM_COUNT    0x3FFFFFFFu
+
+/**
+ * Header of a segment of Count units
+**/
+#define LCD_STREAM_HEADER(DC, Wide, Count) \
+    (((DC) ? LCD_STREAM_DC : 0) | ((Wide) ? LCD_STREAM_WIDE : 0) | (((Count) - 1) & LCD_STREAM_COUNT))
+
+typedef struct {
+    UDOUBLE *Words;
+    UDOUBLE Max;        // room in Words
+    UDOUBLE Count;      // words in use
+} LCD_STREAM;
+
+void LCD_Stream_Init(LCD_STREAM *Stream, UDOUBLE *Words, UDOUBLE Max);
+UBYTE LCD_Stream_Command(LCD_STREAM *Stream, UBYTE Reg, const UBYTE *pData, UWORD Len);
+UBYTE LCD_Stream_Burst(LCD_STREAM *Stream, const UBYTE *pBurst, UWORD Len);
+UBYTE LCD_Stream_PixelHeader(LCD_STREAM *Stream, UDOUBLE Count);
+UDOUBLE LCD_Stream_Pixels(LCD_STREAM *Stream, const UWORD *pPixels, UDOUBLE Count);
+void LCD_Stream_Send(LCD_STREAM *Stream);
+
+#endif
@@ -0,0 +1,312 @@
+/*****************************************************************************
+* | File      	:   LCD_Ticker.c
+* | Function    :   Marquee text band on an LCD panel
+* | Info        :
+*                Text column c lives in slot c % Width, and the band shows
+*                the slots from Slot on. A step writes the columns that
+*                come in over the slots that go out and moves Slot, with
+*                the scroll registers or by sending the ring from Slot.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#include "LCD_Ticker.h"
+#include "Debug.h"
+#include <string.h> //memcpy()
+
+/******************************************************************************
+function :	Render text columns into the strip
+parameter:
+    Ticker : Ticker
+    Column : Text column drawn at strip column Margin
+    Count  : Columns wanted, at most Strip_Width - 2 * Margin
+info:
+    A glyph reaching the wanted columns starts at least Overhang into the
+    strip and ends before its end, so glyphs need no clipping. The passes
+    before and after the one holding Column are drawn too, for columns
+    near the end of the text.
+******************************************************************************/
+static void LCD_Ticker_Render(LCD_TICKER *Ticker, UWORD Column, UWORD Count)
+{
+    const TEXT_LAYOUT *Layout = &Ticker->Layout;
+    PAINT Saved = Paint;
+    int Top = (Ticker->Height - Layout->Line_Height) / 2;
+    int Pass, Passes = Ticker->Length ? 1 : 0, X;
+    UWORD Row, i;
+
+    Paint_NewImage((UBYTE *)Ticker->Strip, Ticker->Strip_Width, Ticker->Height, ROTATE_0, Ticker->Color_Background);
+    Paint_SetScale(65);
+    for (Row = 0; Row < Ticker->Height; Row++)
+        Paint_DrawSpan(Ticker->Margin, Row, Count, Ticker->Color_Background);
+
+    for (Pass = -Passes; Pass <= Passes; Pass++)
+    {
+        for (i = 0; i < Layout->Count; i++)
+        {
+            const TEXT_RUN *Run = &Layout->Runs[i];
+            X = Run->X + Pass * Ticker->Length - Column + Ticker->Margin;
+            if (X < Ticker->Overhang || X >= Ticker->Margin + Count + Ticker->Overhang)
+                continue;
+            Paint_DrawGlyph_Transparent(X, Top + Run->Y, &Run->Glyph, Ticker->Color_Foreground);
+        }
+    }
+    Paint = Saved;
+}
+
+/******************************************************************************
+function :	Put rendered columns in their slots
+info:
+    In the panel a slot is a gate line, the columns go out as one window.
+    Otherwise a slot is a column of the ring.
+******************************************************************************/
+static void LCD_Ticker_Place(LCD_TICKER *Ticker, UWORD Slot, UWORD Count)
+{
+    const UWORD *pRow = &Ticker->Strip[Ticker->Margin];
+    UWORD Row;
+
+    if (Ticker->Hardware)
+    {
+        LCD_Driver_BeginWindow(Ticker->Lcd, Ticker->Region.Xstart + Slot, Ticker->Region.Ystart,
+                               Ticker->Region.Xstart + Slot + Count, Ticker->Region.Yend);
+        for (Row = 0; Row < Ticker->Height; Row++, pRow += Ticker->Strip_Width)
+            DEV_SPI_Write_nWord(pRow, Count);
+        LCD_Driver_EndWindow(Ticker->Lcd);
+        return;
+    }
+    for (Row = 0; Row < Ticker->Height; Row++, pRow += Ticker->Strip_Width)
+        memcpy(&Ticker->Ring[(UDOUBLE)Row * Ticker->Width + Slot], pRow, Count * 2);
+}
+
+/******************************************************************************
+function :	Render text columns into their slots
+parameter:
+    Ticker : Ticker
+    Column : First text column
+    Slot   : Its slot
+    Count  : Number of columns
+info:
+    Done in pieces the strip holds, split where the slots wrap.
+******************************************************************************/
+static void LCD_Ticker_Fill(LCD_TICKER *Ticker, UWORD Column, UWORD Slot, UWORD Count)
+{
+    UWORD Chunk = Ticker->Strip_Width - 2 * Ticker->Margin, Len;
+
+    if (Ticker->Strip_Width <= 2 * Ticker->Margin)
+        return;
+
+    while (Count)
+    {
+        Len = (Count < Chunk) ? Count : Chunk;
+        if (Len > Ticker->Width - Slot)
+            Len = Ticker->Width - Slot;
+        LCD_Ticker_Render(Ticker, Column, Len);
+        LCD_Ticker_Place(Ticker, Slot, Len);
+
+        Column += Len;
+        if (Ticker->Length)
+            Column %= Ticker->Length;
+        Slot = (Slot + Len) % Ticker->Width;
+        Count -= Len;
+    }
+}
+
+/******************************************************************************
+function :	Send ring columns to the band
+parameter:
+    Ticker : Ticker
+    Xpoint : Panel column of the first one
+    Slot   : First ring column
+    Count  : Number of columns
+******************************************************************************/
+static void LCD_Ticker_SendRing(LCD_TICKER *Ticker, UWORD Xpoint, UWORD Slot, UWORD Count)
+{
+    const UWORD *pRow = &Ticker->Ring[Slot];
+    UWORD Row;
+
+    LCD_Driver_BeginWindow(Ticker->Lcd, Xpoint, Ticker->Region.Ystart, Xpoint + Count, Ticker->Region.Yend);
+    for (Row = 0; Row < Ticker->Height; Row++, pRow += Ticker->Width)
+        DEV_SPI_Write_nWord(pRow, Count);
+    LCD_Driver_EndWindow(Ticker->Lcd);
+}
+
+/******************************************************************************
+function :	Show the band from Slot on
+******************************************************************************/
+static void LCD_Ticker_Show(LCD_TICKER *Ticker)
+{
+    UWORD Tail = Ticker->Width - Ticker->Slot;
+
+    if (Ticker->Hardware)
+    {
+        LCD_Driver_Scroll(Ticker->Lcd, Ticker->Region.Xstart, Ticker->Region.Xend, Ticker->Slot);
+        return;
+    }
+    LCD_Ticker_SendRing(Ticker, Ticker->Region.Xstart, Ticker->Slot, Tail);
+    if (Ticker->Slot)
+        LCD_Ticker_SendRing(Ticker, Ticker->Region.Xstart + Tail, 0, Ticker->Slot);
+}
+
+/******************************************************************************
+function :	Set up a ticker
+parameter:
+    Ticker      : Ticker to set up
+    Lcd         : Initialized panel
+    Region      : Band on the panel, ends exclusive
+    Fonts       : Fonts the text is drawn with
+    Buffer      : Render buffer, see LCD_TICKER_BUFFER
+    Buffer_Size : Pixels in Buffer
+    Color_Foreground : Text
+    Color_Background : Band
+info:
+    The panel scrolls the band when its scroll axis is horizontal and the
+    band is full height. The band is then in scroll mode: other drawing
+    must leave it alone until LCD_Ticker_Stop. Otherwise the first
+    Width x Height pixels of the buffer are the ring.
+    Returns 0 when the band or the buffer does not fit. Nothing is drawn
+    until LCD_Ticker_SetText.
+******************************************************************************/
+UBYTE LCD_Ticker_Init(LCD_TICKER *Ticker, LCD_DRIVER *Lcd, const LCD_RECT *Region, PAINT_FONT_SET *Fonts,
+                      UWORD *Buffer, UDOUBLE Buffer_Size, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UDOUBLE Ring_Size, Strip_Width;
+
+    if (Region->Xstart >= Region->Xend || Region->Ystart >= Region->Yend
+        || Region->Xend > Lcd->WIDTH || Region->Yend > Lcd->HEIGHT)
+    {
+        Debug("LCD_Ticker_Init Band exceeds the panel\r\n");
+        return 0;
+    }
+
+    Ticker->Lcd = Lcd;
+    Ticker->Region = *Region;
+    Ticker->Fonts = Fonts;
+    Ticker->Color_Foreground = Color_Foreground;
+    Ticker->Color_Background = Color_Background;
+    Ticker->Width = Region->Xend - Region->Xstart;
+    Ticker->Height = Region->Yend - Region->Ystart;
+    Ticker->Hardware = LCD_Driver_ScrollAxis(Lcd) == HORIZONTAL
+                       && Region->Ystart == 0 && Region->Yend == Lcd->HEIGHT
+                       && Region->Xend + Lcd->Scan->X_Offset <= Lcd->Panel->Lines;
+
+    Ring_Size = Ticker->Hardware ? 0 : (UDOUBLE)Ticker->Width * Ticker->Height;
+    if (Buffer_Size < Ring_Size + Ticker->Height)
+    {
+        Debug("LCD_Ticker_Init Buffer too small for the band\r\n");
+        return 0;
+    }
+    Strip_Width = (Buffer_Size - Ring_Size) / Ticker->Height;
+    Ticker->Ring = Ticker->Hardware ? NULL : Buffer;
+    Ticker->Strip = Buffer + Ring_Size;
+    Ticker->Strip_Width = (Strip_Width > 0xffff) ? 0xffff : Strip_Width;
+
+    Ticker->Overhang = 0;
+    Ticker->Margin = 0;
+    Ticker->Length = 0;
+    Ticker->Offset = 0;
+    Ticker->Slot = 0;
+    Text_NewLayout(&Ticker->Layout, Ticker->Runs, LCD_TICKER_RUNS);
+    return 1;
+}
+
+/******************************************************************************
+function :	Show a text
+parameter:
+    Ticker  : Ticker set up by LCD_Ticker_Init
+    pString : UTF-8 string, one line
+info:
+    Text wider than the band starts at the left edge and moves with
+    LCD_Ticker_Step, passes LCD_TICKER_GAP apart. Shorter text stands
+    still. Returns 0 and draws nothing when the text is the one shown and
+    shorter than TEXT_CACHE_MAX bytes, or when the strip buffer is too
+    small for the fonts.
+******************************************************************************/
+UBYTE LCD_Ticker_SetText(LCD_TICKER *Ticker, const char *pString)
+{
+    TEXT_LAYOUT *Layout = &Ticker->Layout;
+    int Left = 0, Right = 0, Text_Width = 0, Ink;
+    UWORD i;
+
+    if (!Text_Layout(Layout, pString, Ticker->Fonts, 0x7fff, Ticker->Height, TEXT_ALIGN_LEFT))
+        return 0;
+
+    for (i = 0; i < Layout->Count; i++)
+    {
+        const PAINT_GLYPH *Glyph = &Layout->Runs[i].Glyph;
+        Ink = (Glyph->Packed ? Glyph->X_Offset : 0) + Glyph->Width;
+        if (Ink < Glyph->Advance)
+            Ink = Glyph->Advance;
+        if (Ink > Right)
+            Right = Ink;
+        if (Glyph->Packed && -Glyph->X_Offset > Left)
+            Left = -Glyph->X_Offset;
+        if (Layout->Runs[i].X + Glyph->Advance > Text_Width)
+            Text_Width = Layout->Runs[i].X + Glyph->Advance;
+    }
+    if (Ticker->Strip_Width <= 2 * (Left + Right))
+    {
+        // the layout no longer matches what is shown, stop the motion
+        Debug("LCD_Ticker_SetText Buffer too small for the fonts\r\n");
+        Ticker->Length = 0;
+        return 0;
+    }
+    Ticker->Overhang = Left;
+    Ticker->Margin = Left + Right;
+
+    Ticker->Length = (Text_Width > Ticker->Width) ? Text_Width + LCD_TICKER_GAP : 0;
+    Ticker->Offset = 0;
+    Ticker->Slot = 0;
+    LCD_Ticker_Fill(Ticker, 0, 0, Ticker->Width);
+    LCD_Ticker_Show(Ticker);
+    return 1;
+}
+
+/******************************************************************************
+function :	Move the text left
+parameter:
+    Ticker : Ticker showing a text
+    Pixels : Columns to move by
+info:
+    Only the columns that come in are rendered. In the panel they are all
+    that is sent besides the scroll registers; the ring is sent whole.
+******************************************************************************/
+void LCD_Ticker_Step(LCD_TICKER *Ticker, UWORD Pixels)
+{
+    UWORD Skip, Column, Slot;
+
+    if (Ticker->Length == 0 || Pixels == 0)
+        return;
+
+    // Columns that would scroll past in the same step are never shown
+    Skip = (Pixels > Ticker->Width) ? Pixels - Ticker->Width : 0;
+    Column = ((UDOUBLE)Ticker->Offset + Ticker->Width + Skip) % Ticker->Length;
+    Slot = ((UDOUBLE)Ticker->Slot + Skip) % Ticker->Width;
+
+    Ticker->Offset = ((UDOUBLE)Ticker->Offset + Pixels) % Ticker->Length;
+    Ticker->Slot = ((UDOUBLE)Ticker->Slot + Pixels) % Ticker->Width;
+    if (Ticker->Hardware)
+    {
+        LCD_Ticker_Show(Ticker);
+        LCD_Ticker_Fill(Ticker, Column, Slot, Pixels - Skip);
+        return;
+    }
+    LCD_Ticker_Fill(Ticker, Column, Slot, Pixels - Skip);
+    LCD_Ticker_Show(Ticker);
+}
+
+/******************************************************************************
+function :	Give the band back to normal drawing
+info:
+    Leaves scroll mode and rewrites the band as it stands, so the panel
+    memory matches the screen again. A later LCD_Ticker_Step scrolls on.
+******************************************************************************/
+void LCD_Ticker_Stop(LCD_TICKER *Ticker)
+{
+    if (!Ticker->Hardware)
+        return;
+
+    LCD_Driver_ScrollStop(Ticker->Lcd);
+    Ticker->Slot = 0;
+    LCD_Ticker_Fill(Ticker, Ticker->Offset, 0, Ticker->Width);
+}
@@ -0,0 +1,70 @@
+/*****************************************************************************
+* | File      	:   LCD_Ticker.h
+* | Function    :   Marquee text band on an LCD panel
+* | Info        :
+*                Text moves left through a band of the panel. Each step
+*                renders only the columns that scroll in. When the band
+*                spans the gate lines of the panel (full height in a scan
+*                that exchanges rows and columns), the controller scroll
+*                registers move the image and a step sends just the new
+*                columns. Otherwise the band is kept in a ring buffer of
+*                columns and sent rotated.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-18
+* | Info        :
+*
+******************************************************************************/
+#ifndef __LCD_TICKER_H
+#define __LCD_TICKER_H
+
+#include "LCD_Driver.h"
+#include "GUI_Text.h"
+
+/**
+ * Glyphs a ticker holds, RDS RadioText is at most 64 characters
+**/
+#define LCD_TICKER_RUNS     64
+
+/**
+ * Blank pixels between the end of the text and its next pass
+**/
+#define LCD_TICKER_GAP      32
+
+/**
+ * Buffer pixels for a band, Glyph being the widest glyph of the fonts.
+ * Scrolling in the panel uses only the 4 * Glyph strip at the end.
+**/
+#define LCD_TICKER_BUFFER(Width, Height, Glyph) (((Width) + 4 * (Glyph)) * (Height))
+
+/**
+ * A text band on a panel
+**/
+typedef struct {
+    LCD_DRIVER *Lcd;
+    LCD_RECT Region;        // band on the panel, ends exclusive
+    PAINT_FONT_SET *Fonts;
+    UWORD Color_Foreground;
+    UWORD Color_Background;
+    UWORD Width;            // band size
+    UWORD Height;
+    UWORD *Ring;            // Width x Height, column i is slot i, NULL in the panel
+    UWORD *Strip;           // render buffer, Strip_Width x Height
+    UWORD Strip_Width;
+    UWORD Overhang;         // widest glyph ink left of its pen
+    UWORD Margin;           // widest glyph ink, overhang included
+    UWORD Length;           // text and gap, 0 when the text fits and stands still
+    UWORD Offset;           // text column at the left edge of the band
+    UWORD Slot;             // panel line or ring column holding it
+    UBYTE Hardware;         // scrolled by the panel
+    TEXT_LAYOUT Layout;
+    TEXT_RUN Runs[LCD_TICKER_RUNS];
+} LCD_TICKER;
+
+UBYTE LCD_Ticker_Init(LCD_TICKER *Ticker, LCD_DRIVER *Lcd, const LCD_RECT *Region, PAINT_FONT_SET *Fonts,
+                      UWORD *Buffer, UDOUBLE Buffer_Size, UWORD Color_Foreground, UWORD Color_Background);
+UBYTE LCD_Ticker_SetText(LCD_TICKER *Ticker, const char *pString);
+void LCD_Ticker_Step(LCD_TICKER *Ticker, UWORD Pixels);
+void LCD_Ticker_Stop(LCD_TICKER *Ticker);
+
+#endif
@@ -29,6 +29,34 @@
 ******************************************************************************/
 #include "OLED_1in3_c.h"
 #include "stdio.h"
+#include <string.h> //memcmp()
+
+/**
+ * Bytes of one image row, sent as one column of the controller
+**/
+#define OLED_1in3_C_ROW_BYTES ((OLED_1in3_C_WIDTH + 7) / 8)
+
+/**
+ * Controller pages of an image and bytes in each, one per image row
+**/
+#define OLED_1in3_C_PAGES     ((OLED_1in3_C_WIDTH + 7) / 8)
+
+/**
+ * Bit reversal of every byte value
+**/
+#define R2(n) n, n + 2 * 64, n + 1 * 64, n + 3 * 64
+#define R4(n) R2(n), R2(n + 2 * 16), R2(n + 1 * 16), R2(n + 3 * 16)
+#define R6(n) R4(n), R4(n + 2 * 4), R4(n + 1 * 4), R4(n + 3 * 4)
+static const UBYTE OLED_Reverse[256] = {R6(0), R6(2), R6(1), R6(3)};
+#undef R2
+#undef R4
+#undef R6
+
+/**
+ * Rows as last sent, a flush skips the rows that match
+**/
+static UBYTE OLED_Shadow[OLED_1in3_C_HEIGHT][OLED_1in3_C_ROW_BYTES];
+static UBYTE OLED_Shadow_Valid = 0;
 
 /*******************************************************************************
 function:
@@ -65,18 +93,46 @@ static void OLED_WriteReg(uint8_t Reg)
 #endif
 }
 
-static void OLED_WriteData(uint8_t Data)
-{	
+/*******************************************************************************
+function:
+			Write a run of registers or of display data in one transfer
+			I2C sends the control byte once, then the whole run
+*******************************************************************************/
+static void OLED_WriteRun(uint8_t Control, const uint8_t *pData, uint8_t Len)
+{
 #if USE_SPI
-    OLED_DC_1;
+    if (Control == IIC_CMD)
+        OLED_DC_0;
+    else
+        OLED_DC_1;
     OLED_CS_0;
-    DEV_SPI_WriteByte(Data);
+    DEV_SPI_Write_nByte((uint8_t *)pData, Len);
     OLED_CS_1;
 #elif USE_IIC
-    I2C_Write_Byte(Data,IIC_RAM);
+    uint8_t Buf[1 + OLED_1in3_C_HEIGHT];
+    Buf[0] = Control;
+    memcpy(Buf + 1, pData, Len);
+    DEV_I2C_Write_nByte(0x3c, Buf, Len + 1);
 #endif
 }
 
+/*******************************************************************************
+function:
+			Send one image row to its controller column
+*******************************************************************************/
+static void OLED_WriteRow(UWORD Row, const UBYTE *pData)
+{
+    UWORD column = 63 - Row;
+    uint8_t Reg[3] = {
+        0xb0,                       //Set the row  start address
+        0x00 + (column & 0x0f),     //Set column low start address
+        0x10 + (column >> 4),       //Set column higt start address
+    };
+
+    OLED_WriteRun(IIC_CMD, Reg, sizeof(Reg));
+    OLED_WriteRun(IIC_RAM, pData, OLED_1in3_C_ROW_BYTES);
+}
+
 /*******************************************************************************
 function:
 			Common register initialization
@@ -130,6 +186,7 @@ void OLED_1in3_C_Init()
 {
     //Hardware reset
     OLED_Reset();
+    OLED_Shadow_Valid = 0;
 
     //Set the initialization register
     OLED_InitReg();
@@ -146,53 +203,82 @@ function:
 ********************************************************************************/
 void OLED_1in3_C_Clear()
 {
-	UWORD Width, Height, column;
-	Width = (OLED_1in3_C_WIDTH % 8 == 0)? (OLED_1in3_C_WIDTH / 8 ): (OLED_1in3_C_WIDTH / 8 + 1);
-	Height = OLED_1in3_C_HEIGHT;  
-	OLED_WriteReg(0xb0); 	//Set the row  start address
-	for (UWORD j = 0; j < Height; j++) {
-		column = 63 - j;
-		OLED_WriteReg(0x00 + (column & 0x0f));  //Set column low start address
-		OLED_WriteReg(0x10 + (column >> 4));  //Set column higt start address
-		for (UWORD i = 0; i < Width; i++) {
-			OLED_WriteData(0x00);
-		 }
+	memset(OLED_Shadow, 0, sizeof(OLED_Shadow));
+	for (UWORD j = 0; j < OLED_1in3_C_HEIGHT; j++) {
+		OLED_WriteRow(j, OLED_Shadow[j]);
 	}
-}
-
-/********************************************************************************
-function:   
-            reverse a byte data
-********************************************************************************/
-static UBYTE reverse(UBYTE temp)
-{
-    temp = ((temp & 0x55) << 1) | ((temp & 0xaa) >> 1);
-    temp = ((temp & 0x33) << 2) | ((temp & 0xcc) >> 2);
-    temp = ((temp & 0x0f) << 4) | ((temp & 0xf0) >> 4);  
-    return temp;
+	OLED_Shadow_Valid = 1;
 }
 
 /********************************************************************************
 function:	
 			Update all memory to OLED
+info:
+			Each row goes out as one burst, rows unchanged since the last
+			update are skipped, so a static image sends nothing.
 ********************************************************************************/
 void OLED_1in3_C_Display(const UBYTE *Image)
 {		
-    UWORD Width, Height, column, temp;
-    Width = (OLED_1in3_C_WIDTH % 8 == 0)? (OLED_1in3_C_WIDTH / 8 ): (OLED_1in3_C_WIDTH / 8 + 1);
-    Height = OLED_1in3_C_HEIGHT;   
-    OLED_WriteReg(0xb0); 	//Set the row  start address
-    for (UWORD j = 0; j < Height; j++) {
-        column = 63 - j;
-        OLED_WriteReg(0x00 + (column & 0x0f));  //Set column low start address
-        OLED_WriteReg(0x10 + (column >> 4));  //Set column higt start address
-        for (UWORD i = 0; i < Width; i++) {
-            temp = Image[i + j * Width];
-            // printf("0x%x \r\n",temp);
-            temp = reverse(temp);	//reverse the buffer
-            OLED_WriteData(temp);
-         }
-    }   
+    UBYTE Row[OLED_1in3_C_ROW_BYTES];
+
+    for (UWORD j = 0; j < OLED_1in3_C_HEIGHT; j++) {
+        const UBYTE *pSrc = Image + j * OLED_1in3_C_ROW_BYTES;
+        for (UWORD i = 0; i < OLED_1in3_C_ROW_BYTES; i++) {
+            Row[i] = OLED_Reverse[pSrc[i]];	//reverse the buffer
+        }
+        if (OLED_Shadow_Valid && memcmp(Row, OLED_Shadow[j], sizeof(Row)) == 0) {
+            continue;
+        }
+        OLED_WriteRow(j, Row);
+        memcpy(OLED_Shadow[j], Row, sizeof(Row));
+    }
+    OLED_Shadow_Valid = 1;
 }
 
+/********************************************************************************
+function:	
+			Update all memory to OLED from a page image
+parameter:
+			Image : OLED_1in3_C_HEIGHT x OLED_1in3_C_WIDTH image at
+			        PAINT_SCALE_PAGE, drawn with ROTATE_90 so Paint
+			        works in the 128 x 64 view
+info:
+			The image is the controller memory as it is, page p holds
+			its columns 0..63. Each changed page goes out in page
+			addressing mode as one burst.
+********************************************************************************/
+void OLED_1in3_C_DisplayPages(const UBYTE *Image)
+{
+    UBYTE Sent = 0;
 
+    for (UWORD p = 0; p < OLED_1in3_C_PAGES; p++) {
+        const UBYTE *pPage = Image + p * OLED_1in3_C_HEIGHT;
+        UWORD c;
+
+        if (OLED_Shadow_Valid) {
+            for (c = 0; c < OLED_1in3_C_HEIGHT; c++) {
+                if (OLED_Shadow[OLED_1in3_C_HEIGHT - 1 - c][p] != pPage[c])
+                    break;
+            }
+            if (c == OLED_1in3_C_HEIGHT)
+                continue;
+        }
+
+        uint8_t Reg[4] = {
+            0x20,       //Page addressing mode
+            0xb0 + p,   //Set the page address
+            0x00,       //Set column low start address
+            0x10,       //Set column higt start address
+        };
+        OLED_WriteRun(IIC_CMD, Reg, sizeof(Reg));
+        OLED_WriteRun(IIC_RAM, pPage, OLED_1in3_C_HEIGHT);
+        for (c = 0; c < OLED_1in3_C_HEIGHT; c++) {
+            OLED_Shadow[OLED_1in3_C_HEIGHT - 1 - c][p] = pPage[c];
+        }
+        Sent = 1;
+    }
+    if (Sent) {
+        OLED_WriteReg(0x21);	//back to vertical addressing for OLED_1in3_C_Display
+    }
+    OLED_Shadow_Valid = 1;
+}
@@ -59,6 +59,7 @@ function:
 void OLED_1in3_C_Init(void);
 void OLED_1in3_C_Clear(void);
 void OLED_1in3_C_Display(const UBYTE *Image);
+void OLED_1in3_C_DisplayPages(const UBYTE *Image);
 
 #endif  
 	 
@@ -29,8 +29,17 @@
 ******************************************************************************/
 #include "OLED_2in23.h"
 #include "stdio.h"
+#include <string.h> //memset() memcmp()
 
-static uint8_t s_chDispalyBuffer[128][4];
+#define OLED_2in23_PAGES (OLED_2in23_HEIGHT / 8)
+
+/**
+ * Display RAM image, page by page, and the pages changed since the last
+ * refresh, one bit each
+**/
+static uint8_t s_chDispalyBuffer[OLED_2in23_PAGES][OLED_2in23_WIDTH];
+static uint8_t s_chDirty = 0;
+static UDOUBLE s_Last_Commit_ms = 0;
 
 /*******************************************************************************
 function:
@@ -69,15 +78,26 @@ static void OLED_WriteReg(uint8_t Reg)
 #endif
 }
 
-static void OLED_WriteData(uint8_t Data)
-{	
+/*******************************************************************************
+function:
+			Write a run of registers or of display data in one transfer
+			I2C sends the control byte once, then the whole run
+*******************************************************************************/
+static void OLED_WriteRun(uint8_t Control, const uint8_t *pData, uint8_t Len)
+{
 #if USE_SPI
-    OLED_DC_1;
+    if (Control == IIC_CMD)
+        OLED_DC_0;
+    else
+        OLED_DC_1;
     OLED_CS_0;
-    DEV_SPI_WriteByte(Data);
+    DEV_SPI_Write_nByte((uint8_t *)pData, Len);
     OLED_CS_1;
 #elif USE_IIC
-    I2C_Write_Byte(Data,IIC_RAM);
+    uint8_t Buf[1 + OLED_2in23_WIDTH];
+    Buf[0] = Control;
+    memcpy(Buf + 1, pData, Len);
+    DEV_I2C_Write_nByte(0x3c, Buf, Len + 1);
 #endif
 }
 
@@ -115,7 +135,10 @@ static void OLED_InitReg(void)
     OLED_WriteReg(0x08);  	//Set VCOM Deselect Level
 
     OLED_WriteReg(0xAF); 	//-Set Page Addressing Mode (0x00/0x01/0x02)
-   	OLED_2in23_Clear(0x00);
+   	// the GRAM holds whatever it powered up with, send every page
+   	memset(s_chDispalyBuffer, 0x00, sizeof(s_chDispalyBuffer));
+   	s_chDirty = (1 << OLED_2in23_PAGES) - 1;
+   	OLED_2in23_Commit();
    
 }
 
@@ -140,45 +163,108 @@ void OLED_2in23_Init()
 
 /********************************************************************************
 function:
-			Clear screen
+			Send the pages changed since the last commit
+info:
+			Drawing only marks pages, however many calls touched them
+			each goes out once here, as its address commands and its 128
+			bytes. Returns the number of pages sent.
 ********************************************************************************/
-void OLED_2in23_refresh_gram()
+uint8_t OLED_2in23_Commit(void)
 {
-	UWORD i, j;
+	uint8_t i, Count = 0;
 	
-	for (i = 0; i < 4; i ++) {  
-		OLED_WriteReg(0xB0 + i);   
-		OLED_WriteReg(0x04); 
-		OLED_WriteReg(0x10);    
-		for (j = 0; j < 128; j ++) {
-			
-			OLED_WriteData(s_chDispalyBuffer[j][i]); 
+	for (i = 0; i < OLED_2in23_PAGES; i ++) {  
+		if (!(s_chDirty & (1 << i))) {
+			continue;
 		}
+		uint8_t Reg[3] = {0xB0 + i, 0x04, 0x10};
+		OLED_WriteRun(IIC_CMD, Reg, sizeof(Reg));
+		OLED_WriteRun(IIC_RAM, s_chDispalyBuffer[i], OLED_2in23_WIDTH);
+		Count ++;
 	}   
+	s_chDirty = 0;
+	return Count;
+}
+
+/********************************************************************************
+function:
+			Commit at most once a frame
+parameter:
+			Now_ms : Current time, e.g. to_ms_since_boot(get_absolute_time())
+info:
+			Call it from the main loop. Pages drawn within one frame go
+			out together OLED_2in23_FRAME_MS after the previous commit.
+			Returns the number of pages sent.
+********************************************************************************/
+uint8_t OLED_2in23_Service(UDOUBLE Now_ms)
+{
+	if (s_chDirty == 0 || Now_ms - s_Last_Commit_ms < OLED_2in23_FRAME_MS) {
+		return 0;
+	}
+	s_Last_Commit_ms = Now_ms;
+	return OLED_2in23_Commit();
+}
+
+/********************************************************************************
+function:
+			Send the changed pages now, same as OLED_2in23_Commit
+********************************************************************************/
+void OLED_2in23_refresh_gram()
+{
+	OLED_2in23_Commit();
 }
 
 
 
 
+/********************************************************************************
+function:
+			Update the display from a page image
+parameter:
+			Image : OLED_2in23_WIDTH x OLED_2in23_HEIGHT image at
+			        PAINT_SCALE_PAGE, drawn with MIRROR_VERTICAL, which
+			        is the page and bit order of OLED_2in23_draw_point
+info:
+			Only the pages that differ from the display are sent.
+********************************************************************************/
+void OLED_2in23_Display(const UBYTE *Image)
+{
+	uint8_t i;
+	
+	for (i = 0; i < OLED_2in23_PAGES; i ++) {
+		const UBYTE *pPage = Image + i * OLED_2in23_WIDTH;
+		if (memcmp(s_chDispalyBuffer[i], pPage, OLED_2in23_WIDTH) != 0) {
+			memcpy(s_chDispalyBuffer[i], pPage, OLED_2in23_WIDTH);
+			s_chDirty |= 1 << i;
+		}
+	}
+	OLED_2in23_Commit();
+}
+
+/********************************************************************************
+function:
+			Clear screen
+info:
+			Marks the pages that change, OLED_2in23_Commit sends them.
+********************************************************************************/
 void OLED_2in23_Clear(uint8_t chFill)
 {
 	uint8_t i, j;
 	
-	for (i = 0; i < 4; i ++) {
-		OLED_WriteReg(0xB0 + i);
-		OLED_WriteReg(0x04); 
-		OLED_WriteReg(0x10); 
-		for (j = 0; j < 128; j ++) {
-			s_chDispalyBuffer[j][i] = chFill;
+	for (i = 0; i < OLED_2in23_PAGES; i ++) {
+		for (j = 0; j < OLED_2in23_WIDTH; j ++) {
+			if (s_chDispalyBuffer[i][j] != chFill) {
+				memset(s_chDispalyBuffer[i], chFill, OLED_2in23_WIDTH);
+				s_chDirty |= 1 << i;
+				break;
+			}
 		}
 	}
-	
-	OLED_2in23_refresh_gram();
 }
 
 /********************************************************************************
 function:	
-			Update all memory to OLED
+			Set one pixel in the buffer, marking its page if it changes
 ********************************************************************************/
 
 void OLED_2in23_draw_point(uint8_t chXpos, uint8_t chYpos, uint8_t chPoint)
@@ -188,15 +274,19 @@ void OLED_2in23_draw_point(uint8_t chXpos, uint8_t chYpos, uint8_t chPoint)
 	if (chXpos > 127 || chYpos > 31) {
 		return;
 	}
-	chPos = 7 - chYpos / 8; // 
+	chPos = OLED_2in23_PAGES - 1 - chYpos / 8; // pages run bottom up
 	chBx = chYpos % 8;
 	chTemp = 1 << (7 - chBx);
 	
+	uint8_t chOld = s_chDispalyBuffer[chPos][chXpos];
 	if (chPoint) {
-		s_chDispalyBuffer[chXpos][chPos] |= chTemp;
+		s_chDispalyBuffer[chPos][chXpos] |= chTemp;
 		
 	} else {
-		s_chDispalyBuffer[chXpos][chPos] &= ~chTemp;
+		s_chDispalyBuffer[chPos][chXpos] &= ~chTemp;
+	}
+	if (s_chDispalyBuffer[chPos][chXpos] != chOld) {
+		s_chDirty |= 1 << chPos;
 	}
 	
 }
@@ -215,7 +305,6 @@ void OLED_2in23_draw_bitmap(unsigned char x,unsigned char y,const unsigned char
             }
         }
     }
-    OLED_2in23_refresh_gram();    
 }
 
       
@@ -46,6 +46,8 @@ function:
 #define OLED_2in23_WIDTH  128//OLED width
 #define OLED_2in23_HEIGHT 32 //OLED height
 
+#define OLED_2in23_FRAME_MS 40  //shortest time between two OLED_2in23_Service commits
+
 #define OLED_CS_0      DEV_Digital_Write(LCD_CS_PIN,0)
 #define OLED_CS_1      DEV_Digital_Write(LCD_CS_PIN,1)
 
@@ -63,6 +65,9 @@ void OLED_2in23_draw_point(uint8_t chXpos, uint8_t chYpos, uint8_t chPoint);
 void OLED_2in23_draw_bitmap(unsigned char x,unsigned char y,const unsigned char *pBmp, 
 					unsigned char chWidth,unsigned char chHeight);
 void OLED_2in23_refresh_gram(void);
+uint8_t OLED_2in23_Commit(void);
+uint8_t OLED_2in23_Service(UDOUBLE Now_ms);
+void OLED_2in23_Display(const UBYTE *Image);
 
 #endif  
 	 
@@ -0,0 +1,194 @@
+/*
+ * Host stand-ins for DEV_Config and LCD_PIO
+ *
+ * The SPI records each byte with the DC level it went out at. The PIO
+ * transport records the words it would feed the state machine; a chain's
+ * pixel blocks become the words the 16-bit DMA writes, the pixel copied
+ * to both halves. Pin ownership follows LCD_PIO.c: the state machine has
+ * the pins after LCD_PIO_Write and LCD_PIO_Start, and SPI traffic before
+ * an LCD_PIO_Release is counted as an error.
+ */
+#include "mock.h"
+#include <stdio.h>
+
+MOCK_BYTE Mock_Spi[MOCK_MAX];
+UDOUBLE Mock_Spi_Count;
+UDOUBLE Mock_Words[MOCK_MAX];
+UDOUBLE Mock_Words_Count;
+UDOUBLE Mock_Errors;
+UBYTE Mock_Pio_Ready;
+
+static UBYTE Mock_Dc, Mock_Cs = 1;
+static UBYTE Mock_Pio_Pins;
+
+static void Mock_Error(const char *pWhat)
+{
+    if (Mock_Errors++ < 10)
+        printf("  %s\n", pWhat);
+}
+
+static void Mock_Byte(UBYTE Value)
+{
+    if (Mock_Pio_Pins)
+        Mock_Error("SPI used while the PIO owns the pins");
+    if (Mock_Cs)
+        Mock_Error("SPI byte with the panel deselected");
+    if (Mock_Spi_Count < MOCK_MAX)
+        Mock_Spi[Mock_Spi_Count++] = (MOCK_BYTE){Mock_Dc, Value};
+}
+
+void Mock_Reset(void)
+{
+    Mock_Spi_Count = Mock_Words_Count = 0;
+}
+
+void DEV_Digital_Write(UWORD Pin, UBYTE Value)
+{
+    if (Mock_Pio_Pins && (Pin == LCD_DC_PIN || Pin == LCD_CS_PIN))
+        Mock_Error("DC or CS driven while the PIO owns the pins");
+    if (Pin == LCD_DC_PIN)
+        Mock_Dc = Value;
+    else if (Pin == LCD_CS_PIN)
+        Mock_Cs = Value;
+}
+
+void DEV_SPI_WriteByte(UBYTE Value)
+{
+    Mock_Byte(Value);
+}
+
+void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len)
+{
+    uint32_t i;
+
+    for (i = 0; i < Len; i++)
+        Mock_Byte(pData[i]);
+}
+
+void DEV_SPI_Write_nWord(const uint16_t *pData, uint32_t Len)
+{
+    uint32_t i;
+
+    for (i = 0; i < Len; i++)
+    {
+        Mock_Byte(pData[i] >> 8);
+        Mock_Byte(pData[i] & 0xff);
+    }
+}
+
+UDOUBLE DEV_SPI_SetBaud(UDOUBLE Baud)
+{
+    return Baud;
+}
+
+void DEV_SPI_Read(UBYTE Reg, UBYTE Dummy, UBYTE *pData, UBYTE Len)
+{
+    UBYTE i;
+
+    // Selects the panel itself, as DEV_Config.c does
+    DEV_Digital_Write(LCD_DC_PIN, 0);
+    DEV_Digital_Write(LCD_CS_PIN, 0);
+    Mock_Byte(Reg);
+    DEV_Digital_Write(LCD_CS_PIN, 1);
+    for (i = 0; i < Len; i++)
+        pData[i] = 0;
+}
+
+void DEV_Delay_ms(UDOUBLE xms)
+{
+}
+
+static void Mock_Word(UDOUBLE Word)
+{
+    if (Mock_Words_Count < MOCK_MAX)
+        Mock_Words[Mock_Words_Count++] = Word;
+}
+
+UBYTE LCD_PIO_Ready(void)
+{
+    return Mock_Pio_Ready;
+}
+
+void LCD_PIO_Write(const UDOUBLE *pWords, UDOUBLE Count)
+{
+    UDOUBLE i;
+
+    if (Count == 0)
+        return;
+    Mock_Pio_Pins = 1;
+    for (i = 0; i < Count; i++)
+        Mock_Word(pWords[i]);
+}
+
+void LCD_PIO_ChainInit(LCD_PIO_CHAIN *Chain, LCD_PIO_BLOCK *Blocks, UWORD Max)
+{
+    Chain->Blocks = Blocks;
+    Chain->Max = Max;
+    Chain->Count = 0;
+}
+
+static UBYTE Mock_Chain(LCD_PIO_CHAIN *Chain, const void *pRead, UDOUBLE Count, UDOUBLE Size)
+{
+    LCD_PIO_BLOCK *Block;
+
+    if (Chain->Count + 1 >= Chain->Max)
+        return 0;
+    Block = &Chain->Blocks[Chain->Count++];
+    Block->Ctrl = Size;
+    Block->Read = pRead;
+    Block->Write = NULL;
+    Block->Count = Count;
+    return 1;
+}
+
+UBYTE LCD_PIO_ChainWords(LCD_PIO_CHAIN *Chain, const UDOUBLE *pWords, UDOUBLE Count)
+{
+    return Mock_Chain(Chain, pWords, Count, 4);
+}
+
+UBYTE LCD_PIO_ChainPixels(LCD_PIO_CHAIN *Chain, const UWORD *pPixels, UDOUBLE Count)
+{
+    return Mock_Chain(Chain, pPixels, Count, 2);
+}
+
+void LCD_PIO_Start(LCD_PIO_CHAIN *Chain, void (*Done)(void))
+{
+    UWORD i;
+    UDOUBLE j;
+
+    if (Chain->Count == 0)
+        return;
+    Mock_Pio_Pins = 1;
+    for (i = 0; i < Chain->Count; i++)
+    {
+        const LCD_PIO_BLOCK *Block = &Chain->Blocks[i];
+        for (j = 0; j < Block->Count; j++)
+        {
+            if (Block->Ctrl == 4)
+            {
+                Mock_Word(((const UDOUBLE *)Block->Read)[j]);
+            }
+            else
+            {
+                UWORD Pixel = ((const UWORD *)Block->Read)[j];
+                Mock_Word((UDOUBLE)Pixel << 16 | Pixel);
+            }
+        }
+    }
+    if (Done)
+        Done();
+}
+
+UBYTE LCD_PIO_Busy(void)
+{
+    return 0;
+}
+
+void LCD_PIO_Wait(void)
+{
+}
+
+void LCD_PIO_Release(void)
+{
+    Mock_Pio_Pins = 0;
+}
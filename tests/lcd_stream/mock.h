@@ -0,0 +1,28 @@
+/*
+ * Host stand-ins for DEV_Config and LCD_PIO, see mock.c
+ */
+#ifndef _MOCK_H
+#define _MOCK_H
+
+#include "LCD_Driver.h"
+
+#define MOCK_MAX    (1 << 20)
+
+/**
+ * A byte on the SPI and the DC level it went out at
+**/
+typedef struct {
+    UBYTE Dc;
+    UBYTE Value;
+} MOCK_BYTE;
+
+extern MOCK_BYTE Mock_Spi[MOCK_MAX];
+extern UDOUBLE Mock_Spi_Count;
+extern UDOUBLE Mock_Words[MOCK_MAX];
+extern UDOUBLE Mock_Words_Count;
+extern UDOUBLE Mock_Errors;
+extern UBYTE Mock_Pio_Ready;
+
+void Mock_Reset(void);
+
+#endif
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""Run word streams through the lcd_spi PIO program and check the bytes.
+
+Usage: pio_sim.py LCD_PIO.pio REF WORDS...
+
+Parses the program in LCD_PIO.pio (labels, side-set, out/jmp/set, wrap),
+feeds it each WORDS file (one hex word per line, as test_lcd_stream writes
+them) and samples DC and MOSI on every rising SCK edge with CS low. The
+bytes must match REF, the SPI log of LCD_Driver_DisplayWindows.
+"""
+import re
+import sys
+
+
+def load(path):
+    prog, labels = [], {}
+    wrap_target, wrap = 0, None
+    for line in open(path, encoding='utf-8').read().replace('\r', '').split('\n'):
+        line = line.split(';')[0].strip()
+        if not line or line.startswith(('.program', '.side_set')):
+            continue
+        if line.startswith('%'):
+            break
+        if line == '.wrap_target':
+            wrap_target = len(prog)
+            continue
+        if line == '.wrap':
+            wrap = len(prog) - 1
+            continue
+        m = re.match(r'(\w+):$', line)
+        if m:
+            labels[m.group(1)] = len(prog)
+            continue
+        side = None
+        m = re.match(r'(.*?)\s+side\s+(\d)$', line)
+        if m:
+            line, side = m.group(1), int(m.group(2))
+        prog.append((line, side))
+    if len(prog) > 32:
+        sys.exit('%s: %d instructions, the PIO holds 32' % (path, len(prog)))
+    return prog, labels, wrap_target, len(prog) - 1 if wrap is None else wrap
+
+
+def run(program, words):
+    prog, labels, wrap_target, wrap = program
+    pins = {'mosi': 0, 'sck': 0, 'dc': 1, 'cs': 1}
+    osr, shifted, x, y = 0, 32, 0, 0
+    out, bits = [], []
+    pc, wi = wrap_target, 0
+    while True:
+        ins, side = prog[pc]
+        op = ins.split()[0]
+        args = [a.strip() for a in ins[len(op):].split(',')]
+        nextpc = wrap_target if pc == wrap else pc + 1
+        if op == 'out':
+            if shifted >= 32:       # autopull, stall when the FIFO runs dry
+                if wi == len(words):
+                    break
+                osr, shifted = words[wi], 0
+                wi += 1
+            n = int(args[1])
+            v = osr >> (32 - n) & ((1 << n) - 1)
+            osr, shifted = osr << n & 0xffffffff, shifted + n
+            if args[0] == 'x':
+                x = v
+            elif args[0] == 'y':
+                y = v
+            elif args[0] == 'pins':
+                pins['mosi'] = v & 1
+        elif op == 'jmp':
+            if len(args) == 1:
+                nextpc = labels[args[0]]
+            else:
+                cond, label = args
+                if cond == '!x':
+                    take = x == 0
+                elif cond == 'x--':
+                    take, x = x != 0, (x - 1) & 0xffffffff
+                elif cond == 'y--':
+                    take, y = y != 0, (y - 1) & 0xffffffff
+                else:
+                    sys.exit('unsupported jmp condition ' + cond)
+                if take:
+                    nextpc = labels[label]
+        elif op == 'set':
+            v = int(args[1], 0)
+            if args[0] == 'pins':
+                pins['dc'], pins['cs'] = v & 1, v >> 1 & 1
+            elif args[0] == 'y':
+                y = v
+        if side is not None:
+            if side == 1 and pins['sck'] == 0:
+                if pins['cs']:
+                    sys.exit('SCK edge with CS high at pc %d' % pc)
+                bits.append((pins['dc'], pins['mosi']))
+                if len(bits) == 8:
+                    if len({b[0] for b in bits}) != 1:
+                        sys.exit('DC changed inside a byte at pc %d' % pc)
+                    value = int(''.join(str(b[1]) for b in bits), 2)
+                    out.append(('D' if bits[0][0] else 'C') + '%02x' % value)
+                    bits = []
+            pins['sck'] = side
+        pc = nextpc
+    if bits:
+        sys.exit('stream ended %d bits into a byte' % len(bits))
+    return out
+
+
+def main():
+    if len(sys.argv) < 4:
+        sys.exit(__doc__)
+    program = load(sys.argv[1])
+    ref = open(sys.argv[2]).read().split()
+    failed = 0
+    for path in sys.argv[3:]:
+        words = [int(w, 16) for w in open(path).read().split()]
+        out = run(program, words)
+        if out == ref:
+            print('ok   %s decodes to the %d reference bytes' % (path, len(ref)))
+            continue
+        failed += 1
+        first = next((i for i, (a, b) in enumerate(zip(out, ref)) if a != b), min(len(out), len(ref)))
+        print('FAIL %s: %d bytes against %d, first difference at byte %d' % (path, len(out), len(ref), first))
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == '__main__':
+    main()
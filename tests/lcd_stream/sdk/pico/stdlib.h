@@ -0,0 +1,14 @@
+/*
+ * Host stand-in for the Pico SDK, only what DEV_Config.h declares with
+ */
+#ifndef _HOST_PICO_STDLIB_H
+#define _HOST_PICO_STDLIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+typedef uint64_t absolute_time_t;
+
+#endif
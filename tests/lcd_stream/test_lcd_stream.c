@@ -0,0 +1,229 @@
+/*
+ * Host test of the LCD word streams
+ *
+ * Checks the LCD_Stream encoders word for word, that a stream decoded
+ * onto the SPI gives the same bytes as LCD_Driver_DisplayWindows, and
+ * that the driver's SPI paths borrow the pins from the PIO transport,
+ * and that a panel without read-back is calibrated to its rated clock.
+ * The words that would feed the PIO are written to stream.txt and
+ * chain.txt, and the SPI reference to ref.txt, for pio_sim.py.
+ */
+#include "mock.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_WIDTH  240
+#define TEST_HEIGHT 135
+
+static const LCD_PANEL Test_Panel = {
+    LCD_ST7789_Init,
+    {
+        {TEST_WIDTH, TEST_HEIGHT, 0x70, 40, 53},    // HORIZONTAL
+        {TEST_HEIGHT, TEST_WIDTH, 0x00, 52, 40},    // VERTICAL
+    },
+    0,
+    LCD_ST7789_BAUD_MAX,
+    LCD_ST7789_BAUD_RATED,
+    LCD_ST7789_LINES,
+};
+
+static const LCD_RECT Test_Rects[] = {
+    {0, 0, TEST_WIDTH, TEST_HEIGHT},                // whole panel
+    {5, 7, 9, 8},                                   // one row
+    {100, 20, TEST_WIDTH, 60},                      // right edge
+    {TEST_WIDTH - 1, TEST_HEIGHT - 1, TEST_WIDTH, TEST_HEIGHT},
+    {3, 3, 3, 9},                                   // empty, skipped
+    {0, 90, TEST_WIDTH, 100},                       // full rows
+};
+#define TEST_RECTS (sizeof(Test_Rects) / sizeof(Test_Rects[0]))
+
+static UWORD Test_Image[TEST_WIDTH * TEST_HEIGHT];
+static UDOUBLE Test_Words[4096];
+static LCD_PIO_BLOCK Test_Blocks[64];
+static MOCK_BYTE Test_Ref[MOCK_MAX];
+static UDOUBLE Test_Ref_Count;
+static UDOUBLE Test_Failed;
+static UBYTE Test_Done;
+
+static void Test_Check(int Ok, const char *pWhat)
+{
+    printf("%s %s\n", Ok ? "ok  " : "FAIL", pWhat);
+    if (!Ok)
+        Test_Failed++;
+}
+
+static int Test_Same(const UDOUBLE *pWords, UDOUBLE Count, const UDOUBLE *pExpect, UDOUBLE Expect_Count)
+{
+    return Count == Expect_Count && memcmp(pWords, pExpect, Count * sizeof(UDOUBLE)) == 0;
+}
+
+static void Test_Encoders(void)
+{
+    static const UBYTE Caset[4] = {0x00, 0x28, 0x01, 0x17};
+    static const UBYTE Burst[] = {0x11, 0 | LCD_SEQ_DELAY, 120, 0x3A, 1, 0x05};
+    static const UWORD Pixels[3] = {0x1234, 0xABCD, 0xF800};
+    UDOUBLE Words[16];
+    LCD_STREAM Stream;
+
+    const UDOUBLE Command[] = {
+        0x00000000, 0x2A000000,
+        0x80000003, 0x00000000, 0x28000000, 0x01000000, 0x17000000,
+    };
+    LCD_Stream_Init(&Stream, Words, 16);
+    Test_Check(LCD_Stream_Command(&Stream, 0x2A, Caset, 4) &&
+               Test_Same(Words, Stream.Count, Command, 7), "command and parameters");
+
+    const UDOUBLE Seq[] = {
+        0x00000000, 0x11000000,
+        0x00000000, 0x3A000000, 0x80000000, 0x05000000,
+    };
+    LCD_Stream_Init(&Stream, Words, 16);
+    Test_Check(LCD_Stream_Burst(&Stream, Burst, sizeof(Burst)) &&
+               Test_Same(Words, Stream.Count, Seq, 6), "burst skips the delay byte");
+
+    const UDOUBLE Pixel[] = {0xC0000002, 0x12340000, 0xABCD0000, 0xF8000000, 0xC00012BF};
+    LCD_Stream_Init(&Stream, Words, 16);
+    LCD_Stream_Pixels(&Stream, Pixels, 3);
+    LCD_Stream_PixelHeader(&Stream, 0x12C0);
+    Test_Check(Test_Same(Words, Stream.Count, Pixel, 5), "pixels and pixel header");
+
+    LCD_Stream_Init(&Stream, Words, 5);
+    Test_Check(!LCD_Stream_Command(&Stream, 0x2A, Caset, 4) && Stream.Count == 0,
+               "command that does not fit appends nothing");
+    Test_Check(!LCD_Stream_Burst(&Stream, Burst, sizeof(Burst)) && Stream.Count == 0,
+               "burst that does not fit appends nothing");
+
+    LCD_Stream_Init(&Stream, Words, 3);
+    Test_Check(LCD_Stream_Pixels(&Stream, Pixels, 3) == 2 && Stream.Count == 3,
+               "pixels stop where the stream fills up");
+}
+
+static void Test_Save_Bytes(const char *pName, const MOCK_BYTE *pBytes, UDOUBLE Count)
+{
+    FILE *fp = fopen(pName, "w");
+    UDOUBLE i;
+
+    for (i = 0; i < Count; i++)
+        fprintf(fp, "%c%02x\n", pBytes[i].Dc ? 'D' : 'C', pBytes[i].Value);
+    fclose(fp);
+}
+
+static void Test_Save_Words(const char *pName)
+{
+    FILE *fp = fopen(pName, "w");
+    UDOUBLE i;
+
+    for (i = 0; i < Mock_Words_Count; i++)
+        fprintf(fp, "%08x\n", (unsigned)Mock_Words[i]);
+    fclose(fp);
+}
+
+static int Test_Same_As_Ref(void)
+{
+    return Mock_Spi_Count == Test_Ref_Count &&
+           memcmp(Mock_Spi, Test_Ref, Test_Ref_Count * sizeof(MOCK_BYTE)) == 0;
+}
+
+static void Test_Set_Done(void)
+{
+    Test_Done = 1;
+}
+
+static void Test_Driver(void)
+{
+    LCD_DRIVER Lcd;
+    LCD_STREAM Stream;
+    LCD_PIO_CHAIN Chain;
+    UDOUBLE i;
+
+    srand(1);
+    for (i = 0; i < TEST_WIDTH * TEST_HEIGHT; i++)
+        Test_Image[i] = rand();
+
+    Mock_Pio_Ready = 0;
+    LCD_Driver_Init(&Lcd, &Test_Panel, HORIZONTAL);
+
+    // Reference, every window on the SPI
+    Mock_Reset();
+    for (i = 0; i < TEST_RECTS; i++)
+        LCD_Driver_DisplayWindows(&Lcd, Test_Rects[i].Xstart, Test_Rects[i].Ystart,
+                                  Test_Rects[i].Xend, Test_Rects[i].Yend, Test_Image);
+    Test_Ref_Count = Mock_Spi_Count;
+    memcpy(Test_Ref, Mock_Spi, Test_Ref_Count * sizeof(MOCK_BYTE));
+    Test_Save_Bytes("ref.txt", Test_Ref, Test_Ref_Count);
+
+    // The same windows as a stream decoded onto the SPI, in small pieces
+    Mock_Reset();
+    LCD_Stream_Init(&Stream, Test_Words, 300);
+    LCD_Driver_DisplayRects(&Lcd, &Stream, Test_Rects, TEST_RECTS, Test_Image);
+    Test_Check(Mock_Errors == 0 && Test_Same_As_Ref(), "stream on SPI matches DisplayWindows");
+
+    // Stream and chain words for the PIO
+    Mock_Pio_Ready = 1;
+    Mock_Reset();
+    LCD_Stream_Init(&Stream, Test_Words, 4096);
+    LCD_Driver_DisplayRects(&Lcd, &Stream, Test_Rects, TEST_RECTS, Test_Image);
+    Test_Check(Mock_Spi_Count == 0 && Mock_Words_Count > 0, "stream goes to the PIO");
+    Test_Save_Words("stream.txt");
+
+    Mock_Reset();
+    Test_Done = 0;
+    LCD_Stream_Init(&Stream, Test_Words, 4096);
+    LCD_PIO_ChainInit(&Chain, Test_Blocks, 64);
+    Test_Check(LCD_Driver_DisplayRectsAsync(&Lcd, &Stream, &Chain, Test_Rects, TEST_RECTS,
+                                            Test_Image, Test_Set_Done) && Test_Done,
+               "chain sent and completed");
+    Test_Save_Words("chain.txt");
+
+    // The SPI paths borrow the pins from the state machine
+    Mock_Reset();
+    Mock_Errors = 0;
+    LCD_Driver_SendCommand(&Lcd, 0x13, NULL, 0);
+    LCD_Driver_DisplayRects(&Lcd, &Stream, Test_Rects, 1, Test_Image);
+    LCD_Driver_Fill(&Lcd, 0, 0, 10, 10, 0xF800);
+    LCD_Driver_DisplayRects(&Lcd, &Stream, Test_Rects, 1, Test_Image);
+    LCD_Driver_Display(&Lcd, Test_Image);
+    LCD_Driver_DisplayRects(&Lcd, &Stream, Test_Rects, 1, Test_Image);
+    LCD_Driver_Idle(&Lcd, 1);
+    LCD_Driver_DisplayRects(&Lcd, &Stream, Test_Rects, 1, Test_Image);
+    LCD_Driver_Sleep(&Lcd, 1);
+    Test_Check(Mock_Errors == 0 && Mock_Spi_Count > 0, "SPI paths release the PIO pins");
+
+    // Too small for a window: fails, and still completes
+    Test_Done = 0;
+    LCD_Stream_Init(&Stream, Test_Words, LCD_WINDOW_WORDS - 1);
+    LCD_PIO_ChainInit(&Chain, Test_Blocks, LCD_CHAIN_MIN);
+    Test_Check(!LCD_Driver_DisplayRectsAsync(&Lcd, &Stream, &Chain, Test_Rects, 1, Test_Image,
+                                             Test_Set_Done) && Test_Done,
+               "stream too small fails and calls Done");
+    Test_Done = 0;
+    LCD_Stream_Init(&Stream, Test_Words, LCD_WINDOW_WORDS);
+    Test_Check(LCD_Driver_DisplayRectsAsync(&Lcd, &Stream, &Chain, Test_Rects, TEST_RECTS, Test_Image,
+                                            Test_Set_Done) && Test_Done,
+               "smallest stream and chain send everything");
+}
+
+static void Test_Calibrate(void)
+{
+    LCD_PANEL Panel = Test_Panel;
+    LCD_DRIVER Lcd;
+
+    // The mock SPI reads back zeros, as a panel with MISO unconnected
+    Panel.Baud_Max = LCD_ST7735_BAUD_MAX;
+    Panel.Baud_Rated = LCD_ST7735_BAUD_RATED;
+    Mock_Pio_Ready = 0;
+    Mock_Errors = 0;
+    LCD_Driver_Init(&Lcd, &Panel, HORIZONTAL);
+    Test_Check(LCD_Driver_Calibrate(&Lcd) == LCD_ST7735_BAUD_RATED && Mock_Errors == 0,
+               "no read-back keeps the rated clock");
+}
+
+int main(void)
+{
+    Test_Encoders();
+    Test_Driver();
+    Test_Calibrate();
+    printf("%s\n", Test_Failed ? "FAILED" : "passed");
+    return Test_Failed ? 1 : 0;
+}
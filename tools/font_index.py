@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+"""Generate the sorted glyph index of a cFONT table.
+
+Reads a font source such as lib/Fonts/font12CN.c, collects the index bytes
+of every CH_CN entry in table order and writes a header with two
+CH_CN_INDEX arrays for the renderer to binary search:
+
+  <table>_Index   sorted by index[0] << 8 | index[1], so an ASCII entry
+                  "a" is 0x6100 and a GB2312 entry keeps both bytes
+  <table>_UIndex  sorted by Unicode code point, for UTF-8 text
+
+When a code appears more than once the first entry wins, as it did with
+the linear scan.
+
+usage: font_index.py <font.c> <table name> <output.h>
+"""
+import re
+import sys
+
+ENTRY = re.compile(rb'\{\s*\{\s*"((?:[^"\\]|\\.)*)"\s*\}')
+
+
+def glyph_codes(source):
+    codes = []
+    for match in ENTRY.finditer(source):
+        raw = match.group(1)
+        if b"\\" in raw:
+            raw = raw.decode("unicode_escape").encode("latin-1")
+        raw = (raw + b"\0\0")[:2]
+        codes.append(raw[0] << 8 | raw[1])
+    return codes
+
+
+def unicode_of(code):
+    raw = bytes([code >> 8]) if code & 0xFF == 0 else bytes([code >> 8, code & 0xFF])
+    try:
+        text = raw.decode("gb2312")
+    except UnicodeDecodeError:
+        return None
+    return ord(text) if len(text) == 1 and ord(text) <= 0xFFFF else None
+
+
+def main(argv):
+    if len(argv) != 4:
+        sys.stderr.write(__doc__)
+        return 2
+    src_path, table, out_path = argv[1:]
+    with open(src_path, "rb") as f:
+        codes = glyph_codes(f.read())
+    if not codes:
+        sys.stderr.write("%s: no glyphs found\n" % src_path)
+        return 1
+
+    first = {}
+    for glyph, code in enumerate(codes):
+        first.setdefault(code, glyph)
+
+    guard = "__" + re.sub(r"\W", "_", table).upper() + "_INDEX_H"
+    lines = [
+        "/* Generated by tools/font_index.py from %s, do not edit */" % src_path.replace("\\", "/").split("/")[-1],
+        "#ifndef %s" % guard,
+        "#define %s" % guard,
+        "",
+        "static const CH_CN_INDEX %s_Index[] = {" % table,
+    ]
+    for code in sorted(first):
+        lines.append("  {0x%04X, %d}," % (code, first[code]))
+    lines += ["};", ""]
+
+    by_unicode = {}
+    for code, glyph in first.items():
+        point = unicode_of(code)
+        if point is None:
+            sys.stderr.write("%s: 0x%04X is not GB2312, left out of the Unicode index\n" % (src_path, code))
+            continue
+        by_unicode.setdefault(point, glyph)
+    lines.append("static const CH_CN_INDEX %s_UIndex[] = {" % table)
+    for point in sorted(by_unicode):
+        lines.append("  {0x%04X, %d}," % (point, by_unicode[point]))
+    lines += ["};", "", "#endif", ""]
+
+    # always written, so the build sees it newer than the tables it came from
+    with open(out_path, "w") as f:
+        f.write("\n".join(lines))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,547 @@
+#!/usr/bin/env python3
+"""Font compiler: BDF, TTF or an existing font table to lib/Fonts C tables.
+
+Inputs, chosen by file extension:
+
+  .bdf          X11 bitmap font
+  .ttf / .otf   outline font, rasterized at --size pixels (needs Pillow)
+  .c            an sFONT or cFONT table already in lib/Fonts, named by
+                --source-name, so shipped fonts can be subset or repacked
+
+Outputs (--format):
+
+  sfont   fixed cells indexed from ' ', the layout Paint_DrawChar reads.
+          The table always runs from ' ' to the highest character kept;
+          characters left out are stored blank.
+  cfont   CH_CN entries for Paint_DrawString_CN / _UTF8, with the sorted
+          GB2312 and Unicode indexes inline. Only the kept characters are
+          stored; the matrix size is fixed by fonts.h.
+  pfont   proportional glyphs with tight boxes and rows packed with no
+          padding, see pGLYPH in fonts.h. Characters left out cost the
+          8 bytes of their pGLYPH and no bitmap.
+  rfont   fixed cells like sfont, each glyph box stored as per-row runs
+          of background and foreground, see rGLYPH in fonts.h. Pays off
+          from about 16 pixels high; smaller fonts are denser as sfont.
+
+--chars and --range choose the characters to keep, the default is every
+glyph of the input (printable ASCII for TTF). A clock only needs
+--chars "0123456789:" which keeps a few percent of a full table.
+
+usage: fontc.py [options] <input> <output.c>
+"""
+import argparse
+import re
+import sys
+
+FONT_MAX_WIDTH, FONT_MAX_HEIGHT = 32, 41  # MAX_WIDTH_FONT, MAX_HEIGHT_FONT
+
+
+class Glyph:
+    """Ink of one character: rows of 0/1 covering its box."""
+
+    def __init__(self, rows, x_offset, y_offset, advance):
+        self.rows = rows
+        self.x_offset = x_offset  # box left, from the pen
+        self.y_offset = y_offset  # box top, from the line top
+        self.advance = advance
+        self.trim()
+
+    @property
+    def width(self):
+        return len(self.rows[0]) if self.rows else 0
+
+    @property
+    def height(self):
+        return len(self.rows)
+
+    def trim(self):
+        rows = self.rows
+        if not any(v for r in rows for v in r):
+            self.rows = []
+            return
+        while not any(rows[0]):
+            rows = rows[1:]
+            self.y_offset += 1
+        while not any(rows[-1]):
+            rows = rows[:-1]
+        cols = [x for r in rows for x, v in enumerate(r) if v]
+        left, right = min(cols), max(cols)
+        self.rows = [r[left:right + 1] for r in rows]
+        self.x_offset += left
+
+
+class Font:
+    def __init__(self, height, glyphs, fixed_cell=None):
+        self.height = height          # line height
+        self.glyphs = glyphs          # code point -> Glyph
+        self.fixed_cell = fixed_cell  # (width, height) of a cell font
+
+
+# ---------------------------------------------------------------- readers
+
+def read_bdf(path):
+    ascent = descent = None
+    glyphs = {}
+    with open(path, encoding="latin-1") as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        key, _, rest = line.partition(" ")
+        if key == "FONT_ASCENT":
+            ascent = int(rest)
+        elif key == "FONT_DESCENT":
+            descent = int(rest)
+        elif key == "FONTBOUNDINGBOX" and ascent is None:
+            w, h, xo, yo = map(int, rest.split())
+            ascent, descent = h + yo, -yo
+        elif key == "STARTCHAR":
+            code = advance = bbx = None
+            for line in lines:
+                key, _, rest = line.partition(" ")
+                if key == "ENCODING":
+                    code = int(rest.split()[0])
+                elif key == "DWIDTH":
+                    advance = int(rest.split()[0])
+                elif key == "BBX":
+                    bbx = list(map(int, rest.split()))
+                elif key == "BITMAP":
+                    break
+            w, h, xo, yo = bbx
+            rows = []
+            for line in lines:
+                if line.startswith("ENDCHAR"):
+                    break
+                bits = int(line, 16)
+                n = len(line.strip()) * 4
+                rows.append([(bits >> (n - 1 - x)) & 1 for x in range(w)])
+            if code is not None and code >= 0:
+                glyphs[code] = Glyph(rows, xo, ascent - (yo + h), advance)
+    if ascent is None:
+        raise SystemExit("%s: no FONT_ASCENT or FONTBOUNDINGBOX" % path)
+    return Font(ascent + descent, glyphs)
+
+
+def read_ttf(path, size, codes):
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        raise SystemExit("fontc: reading %s needs Pillow (pip install pillow)" % path)
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    glyphs = {}
+    for code in codes:
+        ch = chr(code)
+        advance = int(round(font.getlength(ch)))
+        left, top, right, bottom = font.getbbox(ch, anchor="la")
+        rows = []
+        if right > left and bottom > top:
+            img = Image.new("L", (right - left, bottom - top), 0)
+            ImageDraw.Draw(img).text((-left, -top), ch, font=font, fill=255, anchor="la")
+            px = img.load()
+            rows = [[1 if px[x, y] >= 128 else 0 for x in range(img.width)] for y in range(img.height)]
+        glyphs[code] = Glyph(rows, left, top, advance)
+    return Font(ascent + descent, glyphs)
+
+
+def c_bytes(body):
+    body = re.sub(r"//[^\n]*|/\*.*?\*/", "", body, flags=re.S)
+    return [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{1,2}", body)]
+
+
+def read_c(path, name):
+    with open(path, "rb") as f:
+        text = f.read().decode("latin-1")
+    plain = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+
+    header = re.search(r"sFONT\s+%s\s*=\s*\{\s*(\w+)\s*,\s*(\d+)\s*,\s*(\d+)" % name, plain)
+    if header:
+        table, width, height = header.group(1), int(header.group(2)), int(header.group(3))
+        body = re.search(r"%s\s*\[\s*\]\s*=\s*\{(.*?)\};" % table, text, re.S)
+        data = c_bytes(body.group(1))
+        row_bytes = (width + 7) // 8
+        glyphs = {}
+        for i in range(len(data) // (height * row_bytes)):
+            glyphs[0x20 + i] = Glyph(cell_rows(data, i * height * row_bytes, width, height),
+                                     0, 0, width)
+        return Font(height, glyphs, fixed_cell=(width, height))
+
+    header = re.search(r"cFONT\s+%s\s*=\s*\{\s*(\w+)\s*,[^,]*,\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)" % name, plain)
+    if header:
+        table = header.group(1)
+        ascii_width, width, height = map(int, header.group(2, 3, 4))
+        body = re.search(r"%s\s*\[\s*\]\s*=\s*\{(.*)\};" % table, text, re.S).group(1)
+        row_bytes = (width + 7) // 8
+        glyphs = {}
+        entry = re.compile(r'\{\s*\{\s*"((?:[^"\\]|\\.)*)"\s*\}\s*,\s*\{(.*?)\}\s*\}', re.S)
+        for match in entry.finditer(body):
+            raw = match.group(1).encode("latin-1")
+            if b"\\" in raw:
+                raw = raw.decode("unicode_escape").encode("latin-1")
+            try:
+                code = ord(raw.decode("gb2312"))
+            except (UnicodeDecodeError, TypeError):
+                continue
+            data = c_bytes(match.group(2))
+            glyphs.setdefault(code, Glyph(cell_rows(data, 0, width, height), 0, 0,
+                                          ascii_width if code < 0x80 else width))
+        return Font(height, glyphs, fixed_cell=(width, height))
+
+    raise SystemExit("%s: no sFONT or cFONT named %s" % (path, name))
+
+
+def cell_rows(data, offset, width, height):
+    row_bytes = (width + 7) // 8
+    rows = []
+    for y in range(height):
+        bits = 0
+        for b in data[offset + y * row_bytes:offset + (y + 1) * row_bytes]:
+            bits = bits << 8 | b
+        bits >>= row_bytes * 8 - width
+        rows.append([(bits >> (width - 1 - x)) & 1 for x in range(width)])
+    return rows
+
+
+# -------------------------------------------------------------- transforms
+
+def respace(font):
+    """Give the glyphs of a fixed-cell font proportional advances.
+
+    Every glyph keeps <spacing> pixels of side bearing, half on the left.
+    Digits share the widest digit's advance so numbers do not jitter.
+    """
+    width = font.fixed_cell[0]
+    spacing = max(1, width // 8)
+    digits = [font.glyphs[c].width for c in range(0x30, 0x3A) if c in font.glyphs]
+    digit_w = max(digits) if digits else 0
+    for code, g in font.glyphs.items():
+        if not g.rows:
+            g.x_offset, g.advance = 0, max(2, width // 2)
+        elif 0x30 <= code <= 0x39:
+            g.x_offset, g.advance = spacing // 2 + (digit_w - g.width) // 2, digit_w + spacing
+        else:
+            g.x_offset, g.advance = spacing // 2, g.width + spacing
+    return spacing
+
+
+def kerning(font, kern_min, spacing):
+    """Pairs whose ink can close up by kern_min pixels or more."""
+    profiles = {}
+    for code, g in font.glyphs.items():
+        prof = {}
+        for y, row in enumerate(g.rows):
+            xs = [x for x, v in enumerate(row) if v]
+            if xs:
+                prof[g.y_offset + y] = (g.x_offset + xs[0], g.x_offset + xs[-1])
+        profiles[code] = prof
+    kernable = sorted(c for c in font.glyphs if c < 0x80 and (chr(c).isalpha() or chr(c) in ".,"))
+    if font.fixed_cell:
+        limit = font.fixed_cell[0] // 4
+    else:
+        limit = max(1, max(g.advance for g in font.glyphs.values()) // 4)
+    pairs = []
+    for a in kernable:
+        for b in kernable:
+            if not (chr(a).isupper() or chr(b).isupper()):
+                continue
+            gap = None
+            for y, (_, right) in profiles[a].items():
+                for dy in (-1, 0, 1):
+                    if y + dy in profiles[b]:
+                        g = font.glyphs[a].advance - right - 1 + profiles[b][y + dy][0]
+                        gap = g if gap is None else min(gap, g)
+            if gap is None:
+                continue
+            adjust = min(gap - spacing, limit)
+            if adjust >= kern_min:
+                pairs.append((a, b, -adjust))
+    return pairs
+
+
+def render_cell(g, width, height):
+    cell = [[0] * width for _ in range(height)]
+    for y, row in enumerate(g.rows):
+        for x, v in enumerate(row):
+            cx, cy = g.x_offset + x, g.y_offset + y
+            if v and 0 <= cx < width and 0 <= cy < height:
+                cell[cy][cx] = 1
+    return cell
+
+
+def pack_rows(rows, width):
+    """Rows padded to whole bytes, as sFONT and cFONT store them."""
+    out = []
+    for row in rows:
+        row = row + [0] * (-width % 8)
+        out += [int("".join(map(str, row[i:i + 8])), 2) for i in range(0, len(row), 8)]
+    return out
+
+
+def hex_lines(data, per_line=16, indent="  "):
+    return [indent + ", ".join("0x%02X" % b for b in data[i:i + per_line]) + ","
+            for i in range(0, len(data), per_line)]
+
+
+def char_comment(code):
+    ch = chr(code)
+    return "U+%04X" % code if code < 0x20 or code > 0x7E or ch in "\\" else repr(ch)
+
+
+# ----------------------------------------------------------------- writers
+
+def write_sfont(font, codes, name, width, height):
+    if not codes or max(codes) > 0x7E or min(codes) < 0x20:
+        raise SystemExit("fontc: sfont holds printable ASCII only")
+    out = ["const uint8_t %s_Table[] =" % name, "{"]
+    row_bytes = (width + 7) // 8
+    for code in range(0x20, max(codes) + 1):
+        g = font.glyphs.get(code) if code in codes else None
+        cell = render_cell(g, width, height) if g else [[0] * width for _ in range(height)]
+        out.append("  // @%d %s" % ((code - 0x20) * height * row_bytes, char_comment(code)))
+        for row in cell:
+            out.append("  " + ", ".join("0x%02X" % b for b in pack_rows([row], width)) +
+                       ", // " + "".join("#" if v else " " for v in row))
+        out.append("")
+    out += ["};", "",
+            "sFONT %s = {" % name,
+            "  %s_Table," % name,
+            "  %d, /* Width */" % width,
+            "  %d, /* Height */" % height,
+            "};"]
+    return out
+
+
+def write_cfont(font, codes, name, ascii_width, width, height):
+    if width > FONT_MAX_WIDTH or height > FONT_MAX_HEIGHT:
+        raise SystemExit("fontc: cfont cells are limited to %dx%d" % (FONT_MAX_WIDTH, FONT_MAX_HEIGHT))
+    entries = []
+    for code in codes:
+        try:
+            raw = chr(code).encode("gb2312")
+        except UnicodeEncodeError:
+            sys.stderr.write("fontc: U+%04X is not in GB2312, left out\n" % code)
+            continue
+        if code not in font.glyphs:
+            sys.stderr.write("fontc: U+%04X has no glyph, left out\n" % code)
+            continue
+        entries.append((code, raw))
+
+    out = ["const CH_CN %s_Table[] =" % name, "{"]
+    for code, raw in entries:
+        key = "".join("\\x%02X" % b for b in raw) if code >= 0x80 else chr(code).replace("\\", "\\\\").replace('"', '\\"')
+        out.append("/* %s */" % char_comment(code))
+        out.append('{{"%s"},{' % key)
+        out += hex_lines(pack_rows(render_cell(font.glyphs[code], width, height), width), indent="")
+        out.append("}},")
+    out += ["};", ""]
+
+    index = sorted(((raw[0] << 8 | (raw[1] if len(raw) > 1 else 0)), i) for i, (_, raw) in enumerate(entries))
+    uindex = sorted((code, i) for i, (code, _) in enumerate(entries))
+    for suffix, table in (("Index", index), ("UIndex", uindex)):
+        out.append("static const CH_CN_INDEX %s_%s[] = {" % (name, suffix))
+        out += ["  {0x%04X, %d}," % pair for pair in table]
+        out += ["};", ""]
+    out += ["cFONT %s = {" % name,
+            "  %s_Table," % name,
+            "  sizeof(%s_Table)/sizeof(CH_CN),  /*size of table*/" % name,
+            "  %d, /* ASCII Width */" % ascii_width,
+            "  %d, /* Width */" % width,
+            "  %d, /* Height */" % height,
+            "  %s_Index," % name,
+            "  sizeof(%s_Index)/sizeof(CH_CN_INDEX),  /*size of index*/" % name,
+            "  %s_UIndex," % name,
+            "  sizeof(%s_UIndex)/sizeof(CH_CN_INDEX),  /*size of Unicode index*/" % name,
+            "};"]
+    return out
+
+
+def write_pfont(font, codes, name, kern):
+    codes = [c for c in codes if c <= 0xFF]
+    if not codes:
+        raise SystemExit("fontc: pfont holds characters up to 0xFF")
+    first, last = min(codes), max(codes)
+    bitmap, glyph_lines = [], []
+    for code in range(first, last + 1):
+        g = font.glyphs.get(code) if code in codes else None
+        if g is None:
+            glyph_lines.append("  {%5d,  0,  0,  0,  0,  0}, // %s" % (len(bitmap), char_comment(code)))
+            continue
+        if not (-128 <= g.x_offset < 128 and -128 <= g.y_offset < 128 and g.advance < 256):
+            raise SystemExit("fontc: %s does not fit pGLYPH" % char_comment(code))
+        glyph_lines.append("  {%5d, %2d, %2d, %2d, %2d, %2d}, // %s" %
+                           (len(bitmap), g.width, g.height, g.advance, g.x_offset, g.y_offset,
+                            char_comment(code)))
+        bits = [v for row in g.rows for v in row]
+        bits += [0] * (-len(bits) % 8)
+        bitmap += [int("".join(map(str, bits[i:i + 8])), 2) for i in range(0, len(bits), 8)]
+    bitmap += [0] * 4  # the renderer reads a word past the last glyph
+    if len(bitmap) > 0xFFFF:
+        raise SystemExit("fontc: bitmap too large for 16 bit offsets")
+    kern = [k for k in kern if k[0] in codes and k[1] in codes]
+
+    out = ["static const uint8_t %s_Bitmap[] = {" % name]
+    out += hex_lines(bitmap)
+    out += ["};", "", "static const pGLYPH %s_Glyph[] = {" % name]
+    out += glyph_lines
+    out += ["};", ""]
+    if kern:
+        out.append("static const pKERN %s_Kern[] = {" % name)
+        out += ["  {0x%02X, 0x%02X, %d}," % k for k in kern]
+        out += ["};", ""]
+    out += ["pFONT %s = {" % name,
+            "  %s_Bitmap," % name,
+            "  %s_Glyph," % name,
+            "  %s," % ("%s_Kern" % name if kern else "NULL"),
+            "  %d, /* Kerning pairs */" % len(kern),
+            "  0x%02X, /* First */" % first,
+            "  0x%02X, /* Last */" % last,
+            "  %d, /* Height */" % font.height,
+            "};"]
+    return out
+
+
+def rle_row(row):
+    """One box row as run bytes: end flag, 3 bit background, 4 bit foreground.
+
+    The last byte of a row has bit 7 set and the rest of the row is
+    background. Longer runs are split over several bytes.
+    """
+    runs, x, n = [], 0, len(row)
+    while x < n:
+        bg = 0
+        while x + bg < n and not row[x + bg]:
+            bg += 1
+        x += bg
+        fg = 0
+        while x + fg < n and row[x + fg]:
+            fg += 1
+        x += fg
+        if fg:
+            runs.append((bg, fg))
+    out = []
+    for bg, fg in runs:
+        while bg > 7:
+            out.append(7 << 4)
+            bg -= 7
+        while fg > 15:
+            out.append(bg << 4 | 15)
+            bg, fg = 0, fg - 15
+        out.append(bg << 4 | fg)
+    if not out:
+        out.append(0)
+    out[-1] |= 0x80
+    return out
+
+
+def write_rfont(font, codes, name, width, height):
+    codes = [c for c in codes if c <= 0xFF]
+    if not codes:
+        raise SystemExit("fontc: rfont holds characters up to 0xFF")
+    first, last = min(codes), max(codes)
+    runs, glyph_lines = [], []
+    for code in range(first, last + 1):
+        g = font.glyphs.get(code) if code in codes else None
+        if g is None or not g.rows:
+            glyph_lines.append("  {%5d,  0,  0,  0,  0}, // %s" % (len(runs), char_comment(code)))
+            continue
+        if not (-128 <= g.x_offset < 128 and -128 <= g.y_offset < 128 and g.width < 256):
+            raise SystemExit("fontc: %s does not fit rGLYPH" % char_comment(code))
+        glyph_lines.append("  {%5d, %2d, %2d, %2d, %2d}, // %s" %
+                           (len(runs), g.width, g.height, g.x_offset, g.y_offset, char_comment(code)))
+        for row in g.rows:
+            runs += rle_row(row)
+    if len(runs) > 0xFFFF:
+        raise SystemExit("fontc: runs too large for 16 bit offsets")
+
+    out = ["static const uint8_t %s_Runs[] = {" % name]
+    out += hex_lines(runs)
+    out += ["};", "", "static const rGLYPH %s_Glyph[] = {" % name]
+    out += glyph_lines
+    out += ["};", "",
+            "rFONT %s = {" % name,
+            "  %s_Runs," % name,
+            "  %s_Glyph," % name,
+            "  0x%02X, /* First */" % first,
+            "  0x%02X, /* Last */" % last,
+            "  %d, /* Width */" % width,
+            "  %d, /* Height */" % height,
+            "};"]
+    return out
+
+
+# -------------------------------------------------------------------- main
+
+def parse_codes(args):
+    codes = set()
+    for text in args.chars or []:
+        codes.update(ord(c) for c in text)
+    for spec in args.range or []:
+        lo, _, hi = spec.partition("-")
+        codes.update(range(int(lo, 0), int(hi or lo, 0) + 1))
+    return codes
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("input")
+    ap.add_argument("output")
+    ap.add_argument("--format", choices=("sfont", "cfont", "pfont", "rfont"), required=True)
+    ap.add_argument("--name", required=True, help="C name of the generated font")
+    ap.add_argument("--source-name", help="font to read from a .c input")
+    ap.add_argument("--size", type=int, help="pixel size of a TTF/OTF input")
+    ap.add_argument("--chars", action="append", help="characters to keep, UTF-8")
+    ap.add_argument("--range", action="append", help="code points to keep, e.g. 0x20-0x7E")
+    ap.add_argument("--kern", type=int, default=0, metavar="N",
+                    help="pfont: emit pairs that close up by N pixels or more")
+    ap.add_argument("--width", type=int, help="sfont/cfont/rfont cell width")
+    ap.add_argument("--ascii-width", type=int, help="cfont advance of ASCII characters")
+    args = ap.parse_args()
+
+    codes = parse_codes(args)
+    path = args.input.lower()
+    if path.endswith(".bdf"):
+        font = read_bdf(args.input)
+    elif path.endswith((".ttf", ".otf")):
+        if not args.size:
+            ap.error("--size is required for %s" % args.input)
+        font = read_ttf(args.input, args.size, sorted(codes or range(0x20, 0x7F)))
+    elif path.endswith(".c"):
+        if not args.source_name:
+            ap.error("--source-name is required for %s" % args.input)
+        font = read_c(args.input, args.source_name)
+    else:
+        ap.error("unknown input type: %s" % args.input)
+
+    codes = sorted(c for c in (codes or font.glyphs) if c in font.glyphs)
+    if not codes:
+        raise SystemExit("fontc: no glyphs selected")
+
+    kern = []
+    if args.format == "pfont":
+        spacing = respace(font) if font.fixed_cell else 1
+        if args.kern:
+            kern = kerning(font, args.kern, spacing)
+
+    cell_w = args.width or (font.fixed_cell[0] if font.fixed_cell else
+                            max(max(g.advance, g.x_offset + g.width) for g in font.glyphs.values()))
+    cell_h = font.fixed_cell[1] if font.fixed_cell else font.height
+
+    src = args.input.replace("\\", "/").split("/")[-1]
+    out = ["/* Generated by tools/fontc.py from %s, do not edit */" % src,
+           "#include <stddef.h>",
+           '#include "fonts.h"', ""]
+    if args.format == "sfont":
+        out += write_sfont(font, codes, args.name, cell_w, cell_h)
+    elif args.format == "cfont":
+        ascii_w = args.ascii_width or max([font.glyphs[c].advance for c in codes if c < 0x80] or [cell_w])
+        out += write_cfont(font, codes, args.name, ascii_w, cell_w, cell_h)
+    elif args.format == "rfont":
+        out += write_rfont(font, codes, args.name, cell_w, cell_h)
+    else:
+        out += write_pfont(font, codes, args.name, kern)
+    # always written, so the build sees it newer than the font it came from
+    with open(args.output, "w") as f:
+        f.write("\n".join(out) + "\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())